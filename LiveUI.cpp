@@ -6,6 +6,7 @@
 #include "renderer/Anaglyph.h"
 
 #include "core/TableDB.h"
+#include "captureExt.h"
 
 #include "fonts/DroidSans.h"
 #include "fonts/DroidSansBold.h"
@@ -789,7 +790,7 @@ ImGui::MarkdownImageData LiveUI::MarkdownImageCallback(ImGui::MarkdownLinkCallba
    Texture *const ppi = ui->m_live_table->GetImage(std::string(data.link, data.linkLength));
    if (ppi == nullptr)
       return ImGui::MarkdownImageData {};
-   Sampler *sampler = g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.LoadTexture(ppi->m_pdsBuffer, SamplerFilter::SF_BILINEAR, SamplerAddressMode::SA_CLAMP, SamplerAddressMode::SA_CLAMP, false);
+   Sampler *sampler = g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.LoadTexture(ppi->GetRawBitmap(), SamplerFilter::SF_BILINEAR, SamplerAddressMode::SA_CLAMP, SamplerAddressMode::SA_CLAMP, false);
    if (sampler == nullptr)
       return ImGui::MarkdownImageData {};
    ImTextureID image = (ImTextureID)sampler->GetCoreTexture();  
@@ -1138,8 +1139,8 @@ void LiveUI::OpenTweakMode()
    m_tweakMode = true;
    m_activeTweakPage = m_table->m_szRules.empty() ? (m_player->m_stereo3D == STEREO_VR ? TP_TableOption : TP_PointOfView) : TP_Rules;
    m_activeTweakIndex = 0;
-   m_VRTweakUI_X = g_pvp->m_settings.LoadValueWithDefault(Settings::PlayerVR, "TweakUI_X"s, 450);
-   m_VRTweakUI_Y = g_pvp->m_settings.LoadValueWithDefault(Settings::PlayerVR, "TweakUI_Y"s, 300);
+   m_VRTweakUI_X = g_pvp->m_settings.LoadInt(Settings::PlayerVR_TweakUI_X);
+   m_VRTweakUI_Y = g_pvp->m_settings.LoadInt(Settings::PlayerVR_TweakUI_Y);
    UpdateTweakPage();
 }
 
@@ -1312,19 +1313,19 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
       case BS_ZScale: viewSetup.mSceneScaleZ += 0.005f * incSpeed; break;
       case BS_XOffset:
          if (isWindow)
-            table->m_settings.SaveValue(Settings::Player, "ScreenPlayerX"s, table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerX"s, 0.0f) + 0.5f * incSpeed);
+            table->m_settings.SaveValue(Settings::Player, "ScreenPlayerX"s, table->m_settings.LoadFloat(Settings::Player_ScreenPlayerX) + 0.5f * incSpeed);
          else
             viewSetup.mViewX += 10.f * incSpeed;
          break;
       case BS_YOffset:
          if (isWindow)
-            table->m_settings.SaveValue(Settings::Player, "ScreenPlayerY"s, table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerY"s, 0.0f) + 0.5f * incSpeed);
+            table->m_settings.SaveValue(Settings::Player, "ScreenPlayerY"s, table->m_settings.LoadFloat(Settings::Player_ScreenPlayerY) + 0.5f * incSpeed);
          else
             viewSetup.mViewY += 10.f * incSpeed;
          break;
       case BS_ZOffset:
          if (isWindow)
-            table->m_settings.SaveValue(Settings::Player, "ScreenPlayerZ"s, table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerZ"s, 70.0f) + 0.5f * incSpeed);
+            table->m_settings.SaveValue(Settings::Player, "ScreenPlayerZ"s, table->m_settings.LoadFloat(Settings::Player_ScreenPlayerZ) + 0.5f * incSpeed);
          else
             viewSetup.mViewZ += (viewSetup.mMode == VLM_LEGACY ? 100.f : 10.f) * incSpeed;
          break;
@@ -1425,9 +1426,9 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
    }
    else if (keyEvent == 1) // Key down
    {
-      if (keycode == g_pplayer->m_rgKeys[eLeftTiltKey] && m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "EnableCameraModeFlyAround"s, false))
+      if (keycode == g_pplayer->m_rgKeys[eLeftTiltKey] && m_live_table->m_settings.LoadBool(Settings::Player_EnableCameraModeFlyAround))
          m_live_table->mViewSetups[m_live_table->m_BG_current_set].mViewportRotation -= 1.0f;
-      else if (keycode == g_pplayer->m_rgKeys[eRightTiltKey] && m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "EnableCameraModeFlyAround"s, false))
+      else if (keycode == g_pplayer->m_rgKeys[eRightTiltKey] && m_live_table->m_settings.LoadBool(Settings::Player_EnableCameraModeFlyAround))
          m_live_table->mViewSetups[m_live_table->m_BG_current_set].mViewportRotation += 1.0f;
       else if (keycode == g_pplayer->m_rgKeys[eStartGameKey]) // Save tweak page
       {
@@ -1439,9 +1440,9 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
             m_live_table->mViewSetups[m_live_table->m_BG_current_set].SaveToTableOverrideSettings(m_table->m_settings, m_live_table->m_BG_current_set);
             if (m_live_table->m_BG_current_set == BG_FULLSCREEN)
             { // Player position is saved as an override (not saved if equal to app settings)
-               m_table->m_settings.SaveValue(Settings::Player, "ScreenPlayerX", m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerX"s, 0.0f), true);
-               m_table->m_settings.SaveValue(Settings::Player, "ScreenPlayerY", m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerY"s, 0.0f), true);
-               m_table->m_settings.SaveValue(Settings::Player, "ScreenPlayerZ", m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerZ"s, 70.0f), true);
+               m_table->m_settings.SaveValue(Settings::Player, "ScreenPlayerX", m_live_table->m_settings.LoadFloat(Settings::Player_ScreenPlayerX), true);
+               m_table->m_settings.SaveValue(Settings::Player, "ScreenPlayerY", m_live_table->m_settings.LoadFloat(Settings::Player_ScreenPlayerY), true);
+               m_table->m_settings.SaveValue(Settings::Player, "ScreenPlayerZ", m_live_table->m_settings.LoadFloat(Settings::Player_ScreenPlayerZ), true);
             }
             // The saved value are the new base value, so all fields are marked as untouched
             for (int i = BS_ViewMode; i < BS_WndBottomZOfs; i++)
@@ -1543,8 +1544,8 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
             m_live_table->m_globalDifficulty = g_pvp->m_settings.LoadValueWithDefault(Settings::TableOverride, "Difficulty"s, m_table->m_difficulty);
 
             // Music/sound volume
-            m_player->m_MusicVolume = m_table->m_settings.LoadValueWithDefault(Settings::Player, "MusicVolume"s, 100);
-            m_player->m_SoundVolume = m_table->m_settings.LoadValueWithDefault(Settings::Player, "SoundVolume"s, 100);
+            m_player->m_MusicVolume = m_table->m_settings.LoadInt(Settings::Player_MusicVolume);
+            m_player->m_SoundVolume = m_table->m_settings.LoadInt(Settings::Player_SoundVolume);
 
             // Reset custom options to their default value
             int nTableOptions = (int)m_live_table->m_settings.GetSettings().size();
@@ -1559,8 +1560,8 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
          else if (m_activeTweakPage == TP_VRTweakUI)
          {
             PushNotification("Table options reset to default values"s, 5000);
-            m_VRTweakUI_X = g_pvp->m_settings.LoadValueWithDefault(Settings::PlayerVR, "TweakUI_X"s, 450);
-            m_VRTweakUI_Y = g_pvp->m_settings.LoadValueWithDefault(Settings::PlayerVR, "TweakUI_Y"s, 300);
+            m_VRTweakUI_X = g_pvp->m_settings.LoadInt(Settings::PlayerVR_TweakUI_X);
+            m_VRTweakUI_Y = g_pvp->m_settings.LoadInt(Settings::PlayerVR_TweakUI_Y);
          }
          else if (m_activeTweakPage == TP_PointOfView)
          {
@@ -1604,8 +1605,8 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
                break;
             case BG_FULLSCREEN:
             {
-               const float screenWidth = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "ScreenWidth"s, 0.0f);
-               const float screenHeight = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "ScreenHeight"s, 0.0f);
+               const float screenWidth = g_pvp->m_settings.LoadFloat(Settings::Player_ScreenWidth);
+               const float screenHeight = g_pvp->m_settings.LoadFloat(Settings::Player_ScreenHeight);
                if (screenWidth <= 1.f || screenHeight <= 1.f)
                {
                   PushNotification("You must setup your screen size before using Window mode"s, 5000);
@@ -1695,9 +1696,9 @@ void LiveUI::OnTweakModeEvent(const int keyEvent, const int keycode)
    }
    else
    {
-      if (keycode == eLeftTiltKey && m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "EnableCameraModeFlyAround"s, false))
+      if (keycode == eLeftTiltKey && m_live_table->m_settings.LoadBool(Settings::Player_EnableCameraModeFlyAround))
          m_live_table->mViewSetups[m_live_table->m_BG_current_set].mViewportRotation -= 1.0f;
-      if (keycode == eRightTiltKey && m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "EnableCameraModeFlyAround"s, false))
+      if (keycode == eRightTiltKey && m_live_table->m_settings.LoadBool(Settings::Player_EnableCameraModeFlyAround))
          m_live_table->mViewSetups[m_live_table->m_BG_current_set].mViewportRotation += 1.0f;
    }
 }
@@ -1795,9 +1796,9 @@ void LiveUI::UpdateTweakModeUI()
          case BS_YScale: CM_ROW(setting, isWindow ? "Table YZ Scale" : "Table Y Scale", "%.1f", 100.f * viewSetup.mSceneScaleY / realToVirtual, "%"); break;
          case BS_ZScale: CM_ROW(setting, "Table Z Scale", "%.1f", 100.f * viewSetup.mSceneScaleZ / realToVirtual, "%"); CM_SKIP_LINE; break;
          case BS_LookAt:  if (isLegacy) { CM_ROW(setting, "Inclination", "%.1f", viewSetup.mLookAt, "deg"); } else { CM_ROW(setting, "Look at", "%.1f", viewSetup.mLookAt, "%"); } break;
-         case BS_XOffset: CM_ROW(setting, isLegacy ? "X Offset" : isWindow ? "Player X" : "Camera X", "%.1f", isWindow ? table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerX"s, 0.0f) : VPUTOCM(viewSetup.mViewX), "cm"); break;
-         case BS_YOffset: CM_ROW(setting, isLegacy ? "Y Offset" : isWindow ? "Player Y" : "Camera Y", "%.1f", isWindow ? table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerY"s, 0.0f) : VPUTOCM(viewSetup.mViewY), "cm"); break;
-         case BS_ZOffset: CM_ROW(setting, isLegacy ? "Z Offset" : isWindow ? "Player Z" : "Camera Z", "%.1f", isWindow ? table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenPlayerZ"s, 70.0f) : VPUTOCM(viewSetup.mViewZ), "cm"); CM_SKIP_LINE; break;
+         case BS_XOffset: CM_ROW(setting, isLegacy ? "X Offset" : isWindow ? "Player X" : "Camera X", "%.1f", isWindow ? table->m_settings.LoadFloat(Settings::Player_ScreenPlayerX) : VPUTOCM(viewSetup.mViewX), "cm"); break;
+         case BS_YOffset: CM_ROW(setting, isLegacy ? "Y Offset" : isWindow ? "Player Y" : "Camera Y", "%.1f", isWindow ? table->m_settings.LoadFloat(Settings::Player_ScreenPlayerY) : VPUTOCM(viewSetup.mViewY), "cm"); break;
+         case BS_ZOffset: CM_ROW(setting, isLegacy ? "Z Offset" : isWindow ? "Player Z" : "Camera Z", "%.1f", isWindow ? table->m_settings.LoadFloat(Settings::Player_ScreenPlayerZ) : VPUTOCM(viewSetup.mViewZ), "cm"); CM_SKIP_LINE; break;
          case BS_FOV: CM_ROW(setting, "Field Of View (overall scale)", "%.1f", viewSetup.mFOV, "deg"); break;
          case BS_Layback: CM_ROW(setting, "Layback", "%.1f", viewSetup.mLayback, ""); CM_SKIP_LINE; break;
          case BS_ViewHOfs: CM_ROW(setting, "Horizontal Offset", "%.1f", viewSetup.mViewHOfs, isWindow ? "cm" : ""); break;
@@ -1842,7 +1843,7 @@ void LiveUI::UpdateTweakModeUI()
          // Do not show it as it is more confusing than helpful due to the use of different coordinate systems in settings vs live edit
          //ImGui::Text("Camera at X: %.1fcm Y: %.1fcm Z: %.1fcm", VPUTOCM(viewSetup.mViewX), VPUTOCM(viewSetup.mViewY), VPUTOCM(viewSetup.mViewZ));
          //ImGui::NewLine();
-         if (m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "ScreenWidth"s, 0.0f) <= 1.f)
+         if (m_live_table->m_settings.LoadFloat(Settings::Player_ScreenWidth) <= 1.f)
          {
             ImGui::PushStyleColor(ImGuiCol_Text, IM_COL32(255, 0, 0, 255));
             ImGui::Text("You are using 'Window' mode but haven't defined your display physical size.");
@@ -1902,7 +1903,7 @@ void LiveUI::UpdateTweakModeUI()
          infos.push_back("Credit Key:   Reset page to old values"s);
       }
       infos.push_back("Magna save keys:   Previous/Next option"s);
-      if (m_live_table->m_settings.LoadValueWithDefault(Settings::Player, "EnableCameraModeFlyAround"s, false))
+      if (m_live_table->m_settings.LoadBool(Settings::Player_EnableCameraModeFlyAround))
       {
          infos.push_back("Nudge key:   Rotate table orientation"s);
          infos.push_back("Arrows & Left Alt Key:   Navigate around"s);
@@ -2660,28 +2661,28 @@ void LiveUI::UpdateAudioOptionsModal()
    bool p_open = true;
    if (ImGui::BeginPopupModal(ID_AUDIO_SETTINGS, &p_open, ImGuiWindowFlags_AlwaysAutoResize))
    {
-      bool fsound = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "PlayMusic"s, true);
+      bool fsound = g_pvp->m_settings.LoadBool(Settings::Player_PlayMusic);
       if (ImGui::Checkbox("Enable music", &fsound))
       {
          g_pvp->m_settings.SaveValue(Settings::Player, "PlayMusic"s, fsound);
          m_player->m_PlayMusic = fsound;
       }
 
-      int volume = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "MusicVolume"s, 100);
+      int volume = g_pvp->m_settings.LoadInt(Settings::Player_MusicVolume);
       if (ImGui::SliderInt("Music Volume", &volume, 0, 100))
       {
          g_pvp->m_settings.SaveValue(Settings::Player, "MusicVolume"s, volume);
          m_player->m_MusicVolume = volume;
       }
 
-      fsound = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "PlaySound"s, true);
+      fsound = g_pvp->m_settings.LoadBool(Settings::Player_PlaySound);
       if (ImGui::Checkbox("Enable sound", &fsound))
       {
          g_pvp->m_settings.SaveValue(Settings::Player, "PlaySound"s, fsound);
          m_player->m_PlaySound = fsound;
       }
 
-      volume = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "SoundVolume"s, 100);
+      volume = g_pvp->m_settings.LoadInt(Settings::Player_SoundVolume);
       if (ImGui::SliderInt("Sound Volume", &volume, 0, 100))
       {
          g_pvp->m_settings.SaveValue(Settings::Player, "SoundVolume"s, volume);
@@ -2716,7 +2717,7 @@ void LiveUI::UpdateVideoOptionsModal()
       
       if (ImGui::CollapsingHeader("Ball Rendering", ImGuiTreeNodeFlags_DefaultOpen))
       {
-         bool antiStretch = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BallAntiStretch"s, false);
+         bool antiStretch = g_pplayer->m_ptable->m_settings.LoadBool(Settings::Player_BallAntiStretch);
          if (ImGui::Checkbox("Force round ball", &antiStretch))
          {
             g_pvp->m_settings.SaveValue(Settings::Player, "BallAntiStretch"s, antiStretch);
@@ -2750,16 +2751,16 @@ void LiveUI::UpdateVideoOptionsModal()
                ImGui::PopItemFlag();
                if (m_player->m_stereo3DfakeStereo)
                {
-                  float stereo3DEyeSep = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DMaxSeparation"s, 0.03f);
+                  float stereo3DEyeSep = g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DMaxSeparation);
                   if (ImGui::InputFloat("Max Separation", &stereo3DEyeSep, 0.001f, 0.01f, "%.3f"))
                      g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DMaxSeparation"s, (float)stereo3DEyeSep);
-                  bool stereo3DY = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DYAxis"s, false);
+                  bool stereo3DY = g_pvp->m_settings.LoadBool(Settings::Player_Stereo3DYAxis);
                   if (ImGui::Checkbox("Use Y axis", &stereo3DY))
                      g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DYAxis"s, stereo3DY);
                }
                else
                {
-                  int stereo3DEyeSep = (int)g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DEyeSeparation"s, 63.0f);
+                  int stereo3DEyeSep = (int)g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DEyeSeparation);
                   if (ImGui::InputInt("Eye Separation (mm)", &stereo3DEyeSep, 1, 5))
                      g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DEyeSeparation"s, (float)stereo3DEyeSep);
                }
@@ -2773,19 +2774,19 @@ void LiveUI::UpdateVideoOptionsModal()
             else if (stereo_mode == 2) // Anaglyph
             {
                // Global anaglyph settings
-               float anaglyphSaturation = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DSaturation"s, 1.f);
+               float anaglyphSaturation = g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DSaturation);
                if (ImGui::InputFloat("Saturation", &anaglyphSaturation, 0.01f, 0.1f))
                   g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DSaturation"s, anaglyphSaturation);
-               float anaglyphBrightness = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DBrightness"s, 1.f);
+               float anaglyphBrightness = g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DBrightness);
                if (ImGui::InputFloat("Brightness", &anaglyphBrightness, 0.01f, 0.1f))
                   g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DBrightness"s, anaglyphBrightness);
-               float anaglyphLeftEyeContrast = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DLeftContrast"s, 1.f);
+               float anaglyphLeftEyeContrast = g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DLeftContrast);
                if (ImGui::InputFloat("Left Eye Contrast", &anaglyphLeftEyeContrast, 0.01f, 0.1f))
                   g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DLeftContrast"s, anaglyphLeftEyeContrast);
-               float anaglyphRightEyeContrast = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DRightContrast"s, 1.f);
+               float anaglyphRightEyeContrast = g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DRightContrast);
                if (ImGui::InputFloat("Right Eye Contrast", &anaglyphRightEyeContrast, 0.01f, 0.1f))
                   g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DRightContrast"s, anaglyphRightEyeContrast);
-               float anaglyphDefocus = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DDefocus"s, 0.f);
+               float anaglyphDefocus = g_pvp->m_settings.LoadFloat(Settings::Player_Stereo3DDefocus);
                if (ImGui::InputFloat("Lesser Eye Defocus", &anaglyphDefocus, 0.01f, 0.1f))
                   g_pvp->m_settings.SaveValue(Settings::Player, "Stereo3DDefocus"s, anaglyphDefocus);
 
@@ -3110,6 +3111,10 @@ void LiveUI::UpdateRendererInspectionModal()
          ImGui::TableNextColumn(); ImGui::Text("%s", info);
          PROF_ROW("Input to Script lag", FrameProfiler::PROFILE_INPUT_POLL_PERIOD, "")
          PROF_ROW("Input to Present lag", FrameProfiler::PROFILE_INPUT_TO_PRESENT, "Use PresentMon for Present to Display lag")
+         if (HasDMDCapture() || HasPUPCapture())
+         {
+            PROF_ROW("Capture to Present lag", FrameProfiler::PROFILE_CAPTURE_TO_PRESENT, "External DMD/backglass capture")
+         }
          #undef PROF_ROW
          ImGui::EndTable();
          ImGui::NewLine();
@@ -3586,6 +3591,9 @@ void LiveUI::LightProperties(bool is_live, Light *startup_light, Light *live_lig
       bool startup_shadow = startup_light ? (startup_light->m_d.m_shadows == ShadowMode::RAYTRACED_BALL_SHADOWS) : ShadowMode::NONE;
       bool live_shadow = live_light ? (live_light->m_d.m_shadows == ShadowMode::RAYTRACED_BALL_SHADOWS) : ShadowMode::NONE;
       auto upd_shadow = [light](bool is_live, bool prev, bool v) { light->m_d.m_shadows = v ? ShadowMode::RAYTRACED_BALL_SHADOWS : ShadowMode::NONE; };
+      // The ball light index is built from the live lights, so it only needs to be refreshed when their position or reflection settings are edited
+      auto upd_ball_light = [this](bool is_live, float prev, float v) { if (is_live) m_player->m_ballLightIndex.Invalidate(); };
+      auto upd_ball_reflection = [this](bool is_live, bool prev, bool v) { if (is_live) m_player->m_ballLightIndex.Invalidate(); };
 
       PropSeparator("Light Settings");
       PropFloat("Intensity", startup_light, is_live, startup_light ? &(startup_light->m_d.m_intensity) : nullptr, live_light ? &(live_light->m_d.m_intensity) : nullptr, 0.1f, 1.0f, "%.1f", ImGuiInputTextFlags_CharsDecimal, upd_intensity);
@@ -3622,16 +3630,16 @@ void LiveUI::LightProperties(bool is_live, Light *startup_light, Light *live_lig
       PropSeparator("Bulb");
       PropCheckbox("Render bulb", startup_light, is_live, startup_light ? &(startup_light->m_d.m_showBulbMesh) : nullptr, live_light ? &(live_light->m_d.m_showBulbMesh) : nullptr);
       PropCheckbox("Static rendering", startup_light, is_live, startup_light ? &(startup_light->m_d.m_staticBulbMesh) : nullptr, live_light ? &(live_light->m_d.m_staticBulbMesh) : nullptr);
-      PropFloat("Bulb Size", startup_light, is_live, startup_light ? &(startup_light->m_d.m_meshRadius) : nullptr, live_light ? &(live_light->m_d.m_meshRadius) : nullptr, 1.0f, 5.0f, "%.0f");
+      PropFloat("Bulb Size", startup_light, is_live, startup_light ? &(startup_light->m_d.m_meshRadius) : nullptr, live_light ? &(live_light->m_d.m_meshRadius) : nullptr, 1.0f, 5.0f, "%.0f", ImGuiInputTextFlags_CharsDecimal, upd_ball_light);
 
       PropSeparator("Ball reflections & Shadows");
-      PropCheckbox("Show Reflection on Balls", startup_light, is_live, startup_light ? &(startup_light->m_d.m_showReflectionOnBall) : nullptr, live_light ? &(live_light->m_d.m_showReflectionOnBall) : nullptr);
+      PropCheckbox("Show Reflection on Balls", startup_light, is_live, startup_light ? &(startup_light->m_d.m_showReflectionOnBall) : nullptr, live_light ? &(live_light->m_d.m_showReflectionOnBall) : nullptr, upd_ball_reflection);
       PropCheckbox("Raytraced ball shadows", startup_light, is_live, startup_light ? &startup_shadow : nullptr, live_light ? &live_shadow : nullptr, upd_shadow);
 
       PropSeparator("Position");
-      PropFloat("X", startup_light, is_live, startup_light ? &(startup_light->m_d.m_vCenter.x) : nullptr, live_light ? &(live_light->m_d.m_vCenter.x) : nullptr, 0.1f, 0.5f, "%.1f");
-      PropFloat("Y", startup_light, is_live, startup_light ? &(startup_light->m_d.m_vCenter.y) : nullptr, live_light ? &(live_light->m_d.m_vCenter.y) : nullptr, 0.1f, 0.5f, "%.1f");
-      PropFloat("Z", startup_light, is_live, startup_light ? &(startup_light->m_d.m_height) : nullptr, live_light ? &(live_light->m_d.m_height) : nullptr, 0.1f, 0.5f, "%.1f");
+      PropFloat("X", startup_light, is_live, startup_light ? &(startup_light->m_d.m_vCenter.x) : nullptr, live_light ? &(live_light->m_d.m_vCenter.x) : nullptr, 0.1f, 0.5f, "%.1f", ImGuiInputTextFlags_CharsDecimal, upd_ball_light);
+      PropFloat("Y", startup_light, is_live, startup_light ? &(startup_light->m_d.m_vCenter.y) : nullptr, live_light ? &(live_light->m_d.m_vCenter.y) : nullptr, 0.1f, 0.5f, "%.1f", ImGuiInputTextFlags_CharsDecimal, upd_ball_light);
+      PropFloat("Z", startup_light, is_live, startup_light ? &(startup_light->m_d.m_height) : nullptr, live_light ? &(live_light->m_d.m_height) : nullptr, 0.1f, 0.5f, "%.1f", ImGuiInputTextFlags_CharsDecimal, upd_ball_light);
 
       ImGui::EndTable();
    }
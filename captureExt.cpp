@@ -86,28 +86,30 @@ void ExtCaptureManager::Update()
             delete *capture->m_targetTexture;
             *capture->m_targetTexture = nullptr;
          }
-         // Sleaze alert! - ec creates a HBitmap, but we hijack ec's data pointer to dump its data directly into VP's texture
-         const HDC all_screen = GetDC(nullptr);
-         const int BitsPerPixel = GetDeviceCaps(all_screen, BITSPIXEL);
-         const HDC hdc2 = CreateCompatibleDC(all_screen);
-         BITMAPINFO info;
-         info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-         info.bmiHeader.biWidth = capture->m_width;
-         info.bmiHeader.biHeight = -(int)capture->m_height;
-         info.bmiHeader.biPlanes = 1;
-         info.bmiHeader.biBitCount = (WORD)BitsPerPixel;
-         info.bmiHeader.biCompression = BI_RGB;
-         capture->m_hBitmap = CreateDIBSection(hdc2, &info, DIB_RGB_COLORS, (void**)&capture->m_data, 0, 0);
-
-         *capture->m_targetTexture = BaseTexture::CreateFromHBitmap(capture->m_hBitmap, g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MaxTexDimension"s, 0));
-         capture->m_data = (*capture->m_targetTexture)->data();
+         // The capture thread directly converts the captured frames into the texture data (same layout as the desktop region, no rescaling)
+         BaseTexture* const tex = new BaseTexture(capture->m_width, capture->m_height, BaseTexture::SRGBA);
+         memset(tex->data(), 0, (size_t)tex->pitch() * tex->height());
+         *capture->m_targetTexture = tex;
+         capture->m_data = tex->data();
+         capture->m_tileHashes.clear();
+         capture->m_dirtyRects.clear();
+         capture->m_dirty = true;
          capture->m_state = CS_Capturing;
       }
       else if (capture->m_state == CS_Capturing && capture->m_updated)
       {
-         // We do not lock wait on the update thread when pushing the update information to the texture manager to limit the performance impact
-         capture->m_updated = false;
-         g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.SetDirty(*capture->m_targetTexture);
+         // We do not lock wait on the update thread when pushing the update information to the texture manager to limit the performance impact:
+         // if the update thread is busy, the modified regions are kept and merged with the ones of its next frame (see UpdateCaptureData), to be pushed on a later update
+         if (m_captureMutex.try_lock())
+         {
+            capture->m_updated = false;
+            TextureManager& texMan = g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan;
+            for (const RECT& rect : capture->m_dirtyRects)
+               texMan.SetDirty(*capture->m_targetTexture, rect);
+            capture->m_dirtyRects.clear();
+            m_captureMutex.unlock();
+            g_frameProfiler.OnCaptureUpdate(capture->m_captureTimeStamp);
+         }
       }
    }
 
@@ -115,6 +117,81 @@ void ExtCaptureManager::Update()
    m_updateCV.notify_one();
 }
 
+// Fast non cryptographic hash of a block of 32 bit pixels (FNV-1a like mixing on 4 interleaved 64 bit lanes to avoid a serial dependency on each pixel)
+static uint64_t HashTile(const BYTE* src, const int pitch, const unsigned int width, const unsigned int height)
+{
+   constexpr uint64_t prime = 0x100000001b3ull;
+   uint64_t h0 = 0xcbf29ce484222325ull, h1 = h0 ^ 1, h2 = h0 ^ 2, h3 = h0 ^ 3;
+   for (unsigned int y = 0; y < height; ++y, src += pitch)
+   {
+      const uint32_t* const __restrict row = reinterpret_cast<const uint32_t*>(src);
+      unsigned int x = 0;
+      for (; x + 8 <= width; x += 8)
+      {
+         h0 = (h0 ^ (row[x    ] | ((uint64_t)row[x + 1] << 32))) * prime;
+         h1 = (h1 ^ (row[x + 2] | ((uint64_t)row[x + 3] << 32))) * prime;
+         h2 = (h2 ^ (row[x + 4] | ((uint64_t)row[x + 5] << 32))) * prime;
+         h3 = (h3 ^ (row[x + 6] | ((uint64_t)row[x + 7] << 32))) * prime;
+      }
+      for (; x < width; ++x)
+         h0 = (h0 ^ row[x]) * prime;
+   }
+   return ((h0 * prime ^ h1) * prime ^ h2) * prime ^ h3;
+}
+
+void ExtCaptureManager::UpdateCaptureData(Capture* capture, const BYTE* frame, const int pitch, const unsigned long long timestamp)
+{
+   const unsigned int tilesX = (capture->m_width + CAPTURE_TILE_SIZE - 1) / CAPTURE_TILE_SIZE;
+   const unsigned int tilesY = (capture->m_height + CAPTURE_TILE_SIZE - 1) / CAPTURE_TILE_SIZE;
+   const bool fullCopy = capture->m_tileHashes.size() != (size_t)tilesX * tilesY;
+   if (fullCopy)
+      capture->m_tileHashes.resize((size_t)tilesX * tilesY);
+
+   const BYTE* const src = frame + (size_t)pitch * capture->m_dispTop + capture->m_dispLeft * 4;
+   BYTE* const dst = (BYTE*)capture->m_data;
+   const size_t dstPitch = (size_t)capture->m_width * 4;
+   bool updated = false;
+   for (unsigned int ty = 0, tile = 0; ty < tilesY; ++ty)
+   {
+      const unsigned int y0 = ty * CAPTURE_TILE_SIZE;
+      const unsigned int h = min(CAPTURE_TILE_SIZE, capture->m_height - y0);
+      LONG runStart = -1; // Start of the current horizontal run of modified tiles
+      for (unsigned int tx = 0; tx < tilesX; ++tx, ++tile)
+      {
+         const unsigned int x0 = tx * CAPTURE_TILE_SIZE;
+         const unsigned int w = min(CAPTURE_TILE_SIZE, capture->m_width - x0);
+         const BYTE* sptr = src + (size_t)pitch * y0 + x0 * 4;
+         const uint64_t hash = HashTile(sptr, pitch, w, h);
+         if (!fullCopy && hash == capture->m_tileHashes[tile])
+         {
+            if (runStart >= 0)
+               capture->m_dirtyRects.push_back(RECT { runStart, (LONG)y0, (LONG)x0, (LONG)(y0 + h) });
+            runStart = -1;
+            continue;
+         }
+         capture->m_tileHashes[tile] = hash;
+         updated = true;
+         if (runStart < 0)
+            runStart = x0;
+         // Copy the tile, swapping red and blue channel
+         BYTE* dptr = dst + dstPitch * y0 + x0 * 4;
+         for (unsigned int y = 0; y < h; ++y, sptr += pitch, dptr += dstPitch)
+            copy_bgra_rgba<false>((unsigned int*)dptr, (const unsigned int*)sptr, w);
+      }
+      if (runStart >= 0)
+         capture->m_dirtyRects.push_back(RECT { runStart, (LONG)y0, (LONG)capture->m_width, (LONG)(y0 + h) });
+   }
+
+   if (updated)
+   {
+      // Collapse to a single region if they were not consumed fast enough or are too fragmented, the texture manager would upload the whole texture anyway
+      if (fullCopy || capture->m_dirtyRects.size() > CAPTURE_MAX_DIRTY_RECTS)
+         capture->m_dirtyRects.assign(1, RECT { 0, 0, (LONG)capture->m_width, (LONG)capture->m_height });
+      capture->m_captureTimeStamp = timestamp;
+      capture->m_updated = true;
+   }
+}
+
 // (See for reference implementation: https://github.com/microsoft/Windows-classic-samples/blob/main/Samples/DXGIDesktopDuplication/cpp/DuplicationManager.cpp)
 
 void ExtCaptureManager::UpdateThread()
@@ -230,6 +307,7 @@ void ExtCaptureManager::UpdateThread()
          IDXGIResource* desktop_resource = nullptr;
          DXGI_OUTDUPL_FRAME_INFO frame_info;
          HRESULT hr = duplication->m_duplication->AcquireNextFrame(0, &frame_info, &desktop_resource);
+         const unsigned long long captureTimeStamp = usec();
          if (hr == DXGI_ERROR_WAIT_TIMEOUT)
          {
             // No new frame available, just skip (we use a 0ms timeout to peek for a new frame on each update, keeping previous capture texture data if none)
@@ -353,22 +431,13 @@ void ExtCaptureManager::UpdateThread()
                   }
             }
 
-            // Upload data to target (system) textures, they will be uploaded back to the GPU by the texture manager (this is a fairly inefficient implementation)
+            // Update target (system) textures with the modified tiles, they will be uploaded back to the GPU by the texture manager
             for (Capture* capture : m_captures)
             {
                if (capture->m_duplication == duplication && capture->m_state == CS_Capturing && capture->m_dirty)
                {
                   capture->m_dirty = false;
-                  capture->m_updated = true;
-                  const uint8_t* __restrict sptr = reinterpret_cast<uint8_t*>(srcData) + pitch * capture->m_dispTop;
-                  uint8_t* __restrict ddptr = (uint8_t*)capture->m_data;
-                  for (unsigned int h = 0; h < capture->m_height; ++h)
-                  {
-                     // Copy acquired frame, swapping red and blue channel
-                     copy_bgra_rgba<false>((unsigned int*)ddptr, (const unsigned int*)sptr + capture->m_dispLeft, capture->m_width);
-                     sptr += pitch;
-                     ddptr += capture->m_width * 4;
-                  }
+                  UpdateCaptureData(capture, srcData, pitch, captureTimeStamp);
                }
             }
          }
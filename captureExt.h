@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include <mutex>
+#include <atomic>
 
 void StartDMDCapture();
 void StartPUPCapture();
@@ -203,16 +204,23 @@ private:
       Duplication* m_duplication;
       BaseTexture** m_targetTexture;
       HWND m_window;
-      HBITMAP m_hBitmap;
       void* m_data = nullptr;
       int m_delay = 0;
       bool m_dirty = false; // Data needs to be updated from monitor capture
       bool m_updated = false; // Target texture needs to be reuploaded to GPU
+      std::atomic<unsigned long long> m_captureTimeStamp { 0 }; // Acquisition time of the last capture frame that modified the target texture (written by the capture thread, read when pushing the update)
       UINT m_dispTop = 0, m_dispLeft = 0;
       UINT m_width = 0, m_height = 0;
+      vector<uint64_t> m_tileHashes; // Hash of each CAPTURE_TILE_SIZE tile of the last captured frame, used to skip unchanged parts (empty to force a full copy)
+      vector<RECT> m_dirtyRects; // Regions of the target texture modified since they were last pushed to the texture manager
    };
 
+   static constexpr unsigned int CAPTURE_TILE_SIZE = 32;
+   static constexpr size_t CAPTURE_MAX_DIRTY_RECTS = 64;
+
    void UpdateThread();
+   // Update the capture target texture from a BGRA frame (with the capture region at m_dispLeft/m_dispTop), only converting the tiles that changed since the last frame
+   static void UpdateCaptureData(Capture* capture, const BYTE* frame, const int pitch, const unsigned long long timestamp);
 
    bool m_capturing;
    vector<Capture*> m_captures;
@@ -1022,6 +1022,7 @@ LRESULT LayerTreeView::OnNMClick(LPNMHDR lpnmh)
 
       if (m_activeTable != nullptr)
       {
+         m_activeTable->InvalidateAutoSaveData();
          m_activeTable->SetDirty(eSaveDirty);
          m_activeTable->SetDirtyDraw();
       }
@@ -1080,6 +1081,7 @@ LRESULT LayerTreeView::OnNMDBClick(LPNMHDR lpnmh)
          }
       }
    }
+   m_activeTable->InvalidateAutoSaveData();
    m_activeTable->SetDirty(eSaveDirty);
    m_activeTable->SetDirtyDraw();
    return 0;
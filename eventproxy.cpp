@@ -1 +1,53 @@
 #include "stdafx.h"
+
+// Bit used to mark a pending coalesced event on its object (0 if the event is not coalescable)
+static unsigned int GetCoalescedEventFlag(const DISPID dispid)
+{
+   switch (dispid)
+   {
+   // Animate only notifies that the visual state of the part has changed, so firing it once with the latest state is equivalent to firing it multiple times.
+   // Hit/Unhit/Timer/... are not idempotent (scripts count them, or rely on their exact timing) and are always fired directly.
+   case DISPID_AnimateEvents_Animate: return 1u;
+   default: return 0u;
+   }
+}
+
+bool ScriptEventQueue::Enqueue(IFireEvents * const obj, const DISPID dispid)
+{
+   const unsigned int flag = GetCoalescedEventFlag(dispid);
+   if (m_flushing || flag == 0u)
+      return false;
+   if (obj->m_pendingEvents & flag)
+      g_frameProfiler.OnScriptEventCoalesced(dispid);
+   else
+   {
+      obj->m_pendingEvents |= flag;
+      m_pending.push_back({ obj, dispid });
+   }
+   return true;
+}
+
+void ScriptEventQueue::Flush()
+{
+   // Events fired by the script while flushing are delivered directly
+   m_flushing = true;
+   for (const PendingEvent &evt : m_pending)
+   {
+      evt.obj->m_pendingEvents &= ~GetCoalescedEventFlag(evt.dispid);
+      evt.obj->FireGroupEvent(evt.dispid);
+   }
+   m_pending.clear();
+   m_flushing = false;
+}
+
+void ScriptEventQueue::Clear()
+{
+   for (const PendingEvent &evt : m_pending)
+      evt.obj->m_pendingEvents = 0;
+   m_pending.clear();
+}
+
+bool CoalesceScriptEvent(IFireEvents * const obj, const int dispid)
+{
+   return g_pplayer && g_pplayer->m_scriptEventQueue.Enqueue(obj, dispid);
+}
@@ -1,6 +1,29 @@
 #pragma once
 
 class Ball;
+class IFireEvents;
+
+// Queue used to coalesce idempotent script events (like Animate) of the parts that opted in for it:
+// events are collected during the frame and delivered at most once per object when the queue is flushed.
+class ScriptEventQueue
+{
+public:
+   bool Enqueue(IFireEvents * const obj, const DISPID dispid); // Returns false if the event must be fired directly
+   void Flush();
+   void Clear();
+
+private:
+   struct PendingEvent
+   {
+      IFireEvents *obj;
+      DISPID dispid;
+   };
+   vector<PendingEvent> m_pending;
+   bool m_flushing = false;
+};
+
+// Queue the event in the player's coalesced event queue. Returns false if the event must be fired directly
+bool CoalesceScriptEvent(IFireEvents * const obj, const int dispid);
 
 class EventProxyBase
 {
@@ -17,6 +17,9 @@ public:
    virtual IDebugCommands *GetDebugCommands() = 0;
 
    float   m_currentHitThreshold; // while playing and the ball hits the mesh the hit threshold is updated here
+
+   bool    m_coalesceEvents = false; // opt-in (from script): idempotent events are coalesced and delivered at most once per frame (see ScriptEventQueue)
+   unsigned int m_pendingEvents = 0; // coalesced events waiting for delivery
 };
 
 #define STARTUNDO \
@@ -102,7 +105,7 @@ public:
 	STDMETHOD(get_UserValue)(VARIANT *pVal) {return IEditable::get_UserValue(pVal);} \
 	STDMETHOD(put_UserValue)(VARIANT *newVal) {return IEditable::put_UserValue(newVal);} \
 	virtual IScriptable *GetScriptable() {return (IScriptable *)this;} \
-	virtual void FireGroupEvent(const int dispid) {FireVoidGroupEvent(dispid);}
+	virtual void FireGroupEvent(const int dispid) {if (!m_coalesceEvents || !CoalesceScriptEvent(this, dispid)) FireVoidGroupEvent(dispid);}
 
 // used above, do not invoke directly
 #define _STANDARD_DISPATCH_INDEPENDANT_EDITABLE_DECLARES(T, ItemType) \
@@ -278,4 +281,6 @@ public:
    bool m_singleEvents;
 
    bool m_backglass; // if the light/decal (+dispreel/textbox is always true) is on the table (false) or a backglass view
+
+   FastIStreamData m_autoSaveData; // data of the last autosave, reused until this item gets modified (see PinTable::SaveToStorage)
 };
@@ -74,6 +74,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <memory>
 #include <commdlg.h>
 
 using namespace std::string_literals;
@@ -907,8 +907,38 @@ public:
       v.z = _13 * x + _23 * y + _33 * z + _43;
    }
 
+   // Batch transforms of vertex streams. These ignore the projective part of the matrix (w is assumed to be 1), so they are only valid
+   // for affine transforms (which is always the case for the world matrices used to build the part meshes).
    void TransformVertices(const Vertex3D_NoTex2* const __restrict inVerts, Vertex3D_NoTex2* const __restrict outVerts, const int count) const
    {
+      TransformVertices(inVerts, outVerts, count, *this);
+   }
+
+   // Same as above, but normals are transformed by the rotation part of the given normal matrix instead of this one (usually the
+   // same transform without its scaling)
+   void TransformVertices(const Vertex3D_NoTex2* const __restrict inVerts, Vertex3D_NoTex2* const __restrict outVerts, const int count, const Matrix3D& normalMatrix) const
+   {
+#ifdef ENABLE_SSE_OPTIMIZATIONS
+      const __m128 r0 = _mm_loadu_ps(&_11);
+      const __m128 r1 = _mm_loadu_ps(&_21);
+      const __m128 r2 = _mm_loadu_ps(&_31);
+      const __m128 r3 = _mm_loadu_ps(&_41);
+      const __m128 n0 = _mm_loadu_ps(&normalMatrix._11);
+      const __m128 n1 = _mm_loadu_ps(&normalMatrix._21);
+      const __m128 n2 = _mm_loadu_ps(&normalMatrix._31);
+      for (int i = 0; i < count; ++i)
+      {
+         const __m128 a = _mm_loadu_ps(&inVerts[i].x);  // x  y  z  nx
+         const __m128 b = _mm_loadu_ps(&inVerts[i].ny); // ny nz tu tv
+         const __m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, 0x00), r0), _mm_mul_ps(_mm_shuffle_ps(a, a, 0x55), r1)),
+                                     _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, 0xAA), r2), r3));
+         const __m128 n = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, 0xFF), n0), _mm_mul_ps(_mm_shuffle_ps(b, b, 0x00), n1)),
+                                     _mm_mul_ps(_mm_shuffle_ps(b, b, 0x55), n2));
+         const __m128 t = _mm_shuffle_ps(p, n, _MM_SHUFFLE(0, 0, 2, 2)); // pz pz nx nx
+         _mm_storeu_ps(&outVerts[i].x, _mm_shuffle_ps(p, t, _MM_SHUFFLE(2, 0, 1, 0))); // px py pz nx
+         _mm_storeu_ps(&outVerts[i].ny, _mm_shuffle_ps(n, b, _MM_SHUFFLE(3, 2, 2, 1))); // ny nz tu tv
+      }
+#else
       for (int i = 0; i < count; ++i)
       {
          const float x = inVerts[i].x;
@@ -920,16 +950,33 @@ public:
          outVerts[i].x = _11 * x + _21 * y + _31 * z + _41;
          outVerts[i].y = _12 * x + _22 * y + _32 * z + _42;
          outVerts[i].z = _13 * x + _23 * y + _33 * z + _43;
-         outVerts[i].nx = _11 * nx + _21 * ny + _31 * nz;
-         outVerts[i].ny = _12 * nx + _22 * ny + _32 * nz;
-         outVerts[i].nz = _13 * nx + _23 * ny + _33 * nz;
+         outVerts[i].nx = normalMatrix._11 * nx + normalMatrix._21 * ny + normalMatrix._31 * nz;
+         outVerts[i].ny = normalMatrix._12 * nx + normalMatrix._22 * ny + normalMatrix._32 * nz;
+         outVerts[i].nz = normalMatrix._13 * nx + normalMatrix._23 * ny + normalMatrix._33 * nz;
          outVerts[i].tu = inVerts[i].tu;
          outVerts[i].tv = inVerts[i].tv;
       }
+#endif
    }
 
+   // Only update the position (resp. normal) of the output vertices, leaving the other fields untouched
    void TransformPositions(const Vertex3D_NoTex2* const __restrict inVerts, Vertex3D_NoTex2* const __restrict outVerts, const int count) const
    {
+#ifdef ENABLE_SSE_OPTIMIZATIONS
+      const __m128 r0 = _mm_loadu_ps(&_11);
+      const __m128 r1 = _mm_loadu_ps(&_21);
+      const __m128 r2 = _mm_loadu_ps(&_31);
+      const __m128 r3 = _mm_loadu_ps(&_41);
+      for (int i = 0; i < count; ++i)
+      {
+         const __m128 a = _mm_loadu_ps(&inVerts[i].x); // x y z nx
+         const __m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, 0x00), r0), _mm_mul_ps(_mm_shuffle_ps(a, a, 0x55), r1)),
+                                     _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, 0xAA), r2), r3));
+         _mm_store_ss(&outVerts[i].x, p);
+         _mm_store_ss(&outVerts[i].y, _mm_shuffle_ps(p, p, 0x55));
+         _mm_store_ss(&outVerts[i].z, _mm_movehl_ps(p, p));
+      }
+#else
       for (int i = 0; i < count; ++i)
       {
          const float x = inVerts[i].x;
@@ -939,10 +986,25 @@ public:
          outVerts[i].y = _12 * x + _22 * y + _32 * z + _42;
          outVerts[i].z = _13 * x + _23 * y + _33 * z + _43;
       }
+#endif
    }
 
    void TransformNormals(const Vertex3D_NoTex2* const __restrict inVerts, Vertex3D_NoTex2* const __restrict outVerts, const int count) const
    {
+#ifdef ENABLE_SSE_OPTIMIZATIONS
+      const __m128 r0 = _mm_loadu_ps(&_11);
+      const __m128 r1 = _mm_loadu_ps(&_21);
+      const __m128 r2 = _mm_loadu_ps(&_31);
+      for (int i = 0; i < count; ++i)
+      {
+         const __m128 b = _mm_loadu_ps(&inVerts[i].nx); // nx ny nz tu
+         const __m128 n = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(b, b, 0x00), r0), _mm_mul_ps(_mm_shuffle_ps(b, b, 0x55), r1)),
+                                     _mm_mul_ps(_mm_shuffle_ps(b, b, 0xAA), r2));
+         _mm_store_ss(&outVerts[i].nx, n);
+         _mm_store_ss(&outVerts[i].ny, _mm_shuffle_ps(n, n, 0x55));
+         _mm_store_ss(&outVerts[i].nz, _mm_movehl_ps(n, n));
+      }
+#else
       for (int i = 0; i < count; ++i)
       {
          const float nx = inVerts[i].nx;
@@ -952,6 +1014,7 @@ public:
          outVerts[i].ny = _12 * nx + _22 * ny + _32 * nz;
          outVerts[i].nz = _13 * nx + _23 * ny + _33 * nz;
       }
+#endif
    }
 
    template <class T> void TransformVertices(const T* const __restrict rgv, const WORD* const __restrict rgi, const int count, Vertex2D* const __restrict rgvout, const RECT& viewPort) const
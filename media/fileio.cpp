@@ -378,19 +378,43 @@ BiffReader::BiffReader(IStream *pistream, ILoadable *piloadable, void *ppassdata
    m_version = version;
 
    m_bytesinrecordremaining = 0;
+   m_recordpos = 0;
 
    m_hcrypthash = hcrypthash;
    m_hcryptkey = hcryptkey;
 }
 
-HRESULT BiffReader::ReadBytes(void * const pv, const ULONG count, ULONG * const foo)
+// Read from the current record buffer, then from the stream for the part not available in the buffer
+HRESULT BiffReader::ReadBytesNoHash(void * const pv, const ULONG count, ULONG * const foo)
 {
+   const ULONG buffered = (ULONG)min((size_t)count, m_recordbuffer.size() - m_recordpos);
+   if (buffered > 0)
+   {
+      memcpy(pv, m_recordbuffer.data() + m_recordpos, buffered);
+      m_recordpos += buffered;
+   }
+   if (buffered == count)
+   {
+      if (foo)
+         *foo = count;
+      return S_OK;
+   }
+
    const bool iow = IsOnWine();
    if (iow)
       mtx.lock();
-   const HRESULT hr = m_pistream->Read(pv, count, foo);
+   ULONG read = 0;
+   const HRESULT hr = m_pistream->Read((BYTE *)pv + buffered, count - buffered, &read);
    if (iow)
       mtx.unlock();
+   if (foo)
+      *foo = buffered + read;
+   return hr;
+}
+
+HRESULT BiffReader::ReadBytes(void * const pv, const ULONG count, ULONG * const foo)
+{
+   const HRESULT hr = ReadBytesNoHash(pv, count, foo);
 
    if (m_hcrypthash)
       CryptHashData(m_hcrypthash, (BYTE *)pv, count, 0);
@@ -403,13 +427,7 @@ HRESULT BiffReader::GetIntNoHash(int &value)
    m_bytesinrecordremaining -= sizeof(int);
 
    ULONG read = 0;
-   const bool iow = IsOnWine();
-   if (iow)
-      mtx.lock();
-   const HRESULT hr = m_pistream->Read(&value, sizeof(int), &read);
-   if (iow)
-      mtx.unlock();
-   return hr;
+   return ReadBytesNoHash(&value, sizeof(int), &read);
 }
 
 HRESULT BiffReader::GetInt(void * const value)
@@ -578,6 +596,26 @@ HRESULT BiffReader::Load()
 
       const HRESULT hr = GetInt(tag);
 
+      // Read the record data at once, fields are then decoded from memory instead of going through many small stream reads.
+      // Large records (meshes, binary data,...) are still read directly into their destination to avoid an extra copy.
+      // Tokens that read directly from m_pistream (fonts, image bits, script,...) are saved as tag-only records followed by
+      // their raw data, so the buffer is always empty for them.
+      if (hr == S_OK && m_version > 30 && m_bytesinrecordremaining > 0 && m_bytesinrecordremaining <= 64 * 1024)
+      {
+         m_recordbuffer.resize(m_bytesinrecordremaining);
+         m_recordpos = 0;
+         ULONG read = 0;
+         const bool iow = IsOnWine();
+         if (iow)
+            mtx.lock();
+         const HRESULT hrRecord = m_pistream->Read(m_recordbuffer.data(), (ULONG)m_recordbuffer.size(), &read);
+         if (iow)
+            mtx.unlock();
+         if (FAILED(hrRecord))
+            return hrRecord;
+         m_recordbuffer.resize(read);
+      }
+
       bool cont = false;
       if (hr == S_OK)
          cont = m_piloadable->LoadToken(tag, this);
@@ -596,6 +634,9 @@ HRESULT BiffReader::Load()
             delete[] szT;
          }
       }
+
+      m_recordbuffer.clear();
+      m_recordpos = 0;
    }
 
    return S_OK;
@@ -712,9 +753,24 @@ HRESULT __stdcall FastIStorage::CopyTo(ULONG, const struct _GUID *, WCHAR **, st
       }
    }
 
+   for (const auto &sharedStream : m_vsharedstm)
+   {
+      if (SUCCEEDED(hr = pstgNew->CreateStream(sharedStream.first.c_str(), STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmT)))
+      {
+         ULONG writ;
+         pstmT->Write(sharedStream.second->data(), (ULONG)sharedStream.second->size(), &writ);
+         pstmT->Release();
+      }
+   }
+
    return S_OK;
 }
 
+void FastIStorage::AddSharedStream(const WCHAR *wzName, const FastIStreamData &data)
+{
+   m_vsharedstm.emplace_back(wstring(wzName), data);
+}
+
 HRESULT __stdcall FastIStorage::MoveElementTo(const WCHAR *, struct IStorage *, const WCHAR *, ULONG)
 {
    return S_OK;
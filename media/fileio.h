@@ -106,12 +106,21 @@ public:
    HCRYPTKEY m_hcryptkey;
 
 private:
+   HRESULT ReadBytesNoHash(void * const pv, const ULONG count, ULONG * const foo);
+
    ILoadable *m_piloadable;
    int m_bytesinrecordremaining;
+
+   // Data of the current record, read at once when its header is parsed (records of legacy files without sizes are read directly from the stream)
+   vector<BYTE> m_recordbuffer;
+   size_t m_recordpos;
 };
 
 class FastIStream;
 
+// Immutable encoded stream data, that can be shared between storages instead of being copied (see PinTable::AutoSave)
+typedef std::shared_ptr<const vector<char>> FastIStreamData;
+
 class FastIStorage : public IStorage
 {
 public:
@@ -138,11 +147,14 @@ public:
    HRESULT __stdcall SetStateBits(ULONG, ULONG);
    HRESULT __stdcall Stat(struct tagSTATSTG *, ULONG);
 
+   void AddSharedStream(const WCHAR *wzName, const FastIStreamData &data);
+
 private:
    int m_cref;
 
    vector<FastIStorage*> m_vstg;
    vector<FastIStream*> m_vstm;
+   vector<std::pair<wstring, FastIStreamData>> m_vsharedstm;
 
    WCHAR *m_wzName;
 };
@@ -50,12 +50,13 @@ void Pin3D::TransformVertices(const Vertex3Ds* const __restrict rgv, const WORD*
    m_mvp->GetModelViewProj(0).TransformVertices(rgv, rgi, count, rgvout, viewport);
 }
 
-BaseTexture* EnvmapPrecalc(const Texture* envTex, const unsigned int rad_env_xres, const unsigned int rad_env_yres)
+BaseTexture* EnvmapPrecalc(Texture* envTex, const unsigned int rad_env_xres, const unsigned int rad_env_yres)
 {
-   const void* __restrict envmap = envTex->m_pdsBuffer->data();
-   const unsigned int env_xres = envTex->m_pdsBuffer->width();
-   const unsigned int env_yres = envTex->m_pdsBuffer->height();
-   BaseTexture::Format env_format = envTex->m_pdsBuffer->m_format;
+   BaseTexture* const envBitmap = envTex->GetRawBitmap();
+   const void* __restrict envmap = envBitmap->data();
+   const unsigned int env_xres = envBitmap->width();
+   const unsigned int env_yres = envBitmap->height();
+   BaseTexture::Format env_format = envBitmap->m_format;
    const BaseTexture::Format rad_format = (env_format == BaseTexture::RGB_FP16 || env_format == BaseTexture::RGB_FP32) ? env_format : BaseTexture::SRGB;
    BaseTexture* radTex = new BaseTexture(rad_env_xres, rad_env_yres, rad_format);
    BYTE* const __restrict rad_envmap = radTex->data();
@@ -475,9 +476,9 @@ HRESULT Pin3D::InitPin3D(const bool fullScreen, const int width, const int heigh
    PLOGI << "Computing environment map radiance"; // For profiling
    #ifdef ENABLE_SDL // OpenGL
    Texture* const envTex = m_envTexture ? m_envTexture : &m_builtinEnvTexture;
-   const int envTexHeight = min(envTex->m_pdsBuffer->height(), 256u) / 8;
+   const int envTexHeight = min(envTex->GetRawBitmap()->height(), 256u) / 8;
    const int envTexWidth = envTexHeight * 2;
-   const colorFormat rad_format = envTex->m_pdsBuffer->m_format == BaseTexture::RGB_FP32 ? colorFormat::RGBA32F : colorFormat::RGBA16F;
+   const colorFormat rad_format = envTex->GetRawBitmap()->m_format == BaseTexture::RGB_FP32 ? colorFormat::RGBA32F : colorFormat::RGBA16F;
    m_envRadianceTexture = new RenderTarget(m_pd3dPrimaryDevice, SurfaceType::RT_DEFAULT, "Irradiance"s, envTexWidth, envTexHeight, rad_format, false, 1, "Failed to create irradiance render target");
    m_pd3dPrimaryDevice->FBShader->SetTechnique(SHADER_TECHNIQUE_irradiance);
    m_pd3dPrimaryDevice->FBShader->SetTexture(SHADER_tex_env, envTex);
@@ -488,8 +489,8 @@ HRESULT Pin3D::InitPin3D(const bool fullScreen, const int width, const int heigh
    m_pd3dPrimaryDevice->m_ballShader->SetTexture(SHADER_tex_diffuse_env, m_envRadianceTexture->GetColorSampler());
    #else // DirectX 9
    // DirectX 9 does not support bitwise operation in shader, so radical_inverse is not implemented and therefore we use the slow CPU path instead of GPU
-   const Texture* const envTex = m_envTexture ? m_envTexture : &m_builtinEnvTexture;
-   const unsigned int envTexHeight = min(envTex->m_pdsBuffer->height(), 256u) / 8;
+   Texture* const envTex = m_envTexture ? m_envTexture : &m_builtinEnvTexture;
+   const unsigned int envTexHeight = min(envTex->GetRawBitmap()->height(), 256u) / 8;
    const unsigned int envTexWidth = envTexHeight * 2;
    m_envRadianceTexture = EnvmapPrecalc(envTex, envTexWidth, envTexHeight);
    m_pd3dPrimaryDevice->m_texMan.SetDirty(m_envRadianceTexture);
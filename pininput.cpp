@@ -48,6 +48,8 @@ PinInput::PinInput()
 
    ZeroMemory(m_diq, sizeof(m_diq));
 
+   m_inputThread = nullptr;
+
    m_num_joy = 0;
 #ifdef _WIN32
    for (int k = 0; k < PININ_JOYMXCNT; ++k)
@@ -201,6 +203,7 @@ void PinInput::LoadSettings(const Settings& settings)
    m_enableMouseInPlayer = settings.LoadValueWithDefault(Settings::Player, "EnableMouseInPlayer"s, m_enableMouseInPlayer);
    m_enableCameraModeFlyAround = settings.LoadValueWithDefault(Settings::Player, "EnableCameraModeFlyAround"s, m_enableCameraModeFlyAround);
    m_enable_nudge_filter = settings.LoadValueWithDefault(Settings::Player, "EnableNudgeFilter"s, m_enable_nudge_filter);
+   m_useInputThread = settings.LoadValueWithDefault(Settings::Player, "InputThread"s, m_useInputThread);
    m_deadz = settings.LoadValueWithDefault(Settings::Player, "DeadZone"s, 0);
    m_deadz = m_deadz*JOYRANGEMX / 100;
 }
@@ -376,8 +379,24 @@ BOOL CALLBACK EnumJoystickCallbackDI(LPCDIDEVICEINSTANCE lpddi, LPVOID pvRef)
 }
 #endif
 
+// Set for the input polling thread, whose events are pushed to the timestamped event queue
+static thread_local bool isInputThread = false;
+
 void PinInput::PushQueue(DIDEVICEOBJECTDATA * const data, const unsigned int app_data/*, const U32 curr_time_msec*/)
 {
+   if (data && isInputThread)
+   {
+      const unsigned int head = m_threadEventsHead.load(std::memory_order_relaxed);
+      if (head - m_threadEventsTail.load(std::memory_order_acquire) == MAX_INPUT_THREAD_QUEUE_SIZE) // queue full?
+         return;
+      TimedInputEvent &ev = m_threadEvents[head & (MAX_INPUT_THREAD_QUEUE_SIZE - 1)];
+      ev.data = *data;
+      ev.data.dwSequence = app_data;
+      ev.timestamp = usec();
+      m_threadEventsHead.store(head + 1, std::memory_order_release);
+      return;
+   }
+
    if ((!data) ||
        (((m_head + 1) % MAX_KEYQUEUE_SIZE) == m_tail)) // queue full?
        return;
@@ -406,14 +425,65 @@ const DIDEVICEOBJECTDATA *PinInput::GetTail(/*const U32 curr_sim_msec*/)
    //else return nullptr;
 }
 
+// Move the events polled by the input thread to the input queue, up to the given time (later ones will be processed when the simulation reaches them)
+void PinInput::PopInputThreadEvents(const U64 curr_sim_usec)
+{
+   unsigned int tail = m_threadEventsTail.load(std::memory_order_relaxed);
+   const unsigned int head = m_threadEventsHead.load(std::memory_order_acquire);
+   while (tail != head && ((m_head + 1) % MAX_KEYQUEUE_SIZE) != m_tail)
+   {
+      const TimedInputEvent &ev = m_threadEvents[tail & (MAX_INPUT_THREAD_QUEUE_SIZE - 1)];
+      if (ev.timestamp > curr_sim_usec)
+         break;
+      m_diq[m_head] = ev.data;
+      m_head = (m_head + 1) % MAX_KEYQUEUE_SIZE;
+      tail++;
+   }
+   m_threadEventsTail.store(tail, std::memory_order_release);
+}
+
+void PinInput::StartInputThread()
+{
+#ifdef _WIN32
+   // SDL and Windows.Gaming.Input events must be polled from the main thread
+   if (!m_useInputThread || m_inputThread || (m_inputApi != 0 && m_inputApi != 1))
+      return;
+
+   m_threadEventsHead = m_threadEventsTail = 0;
+   m_inputThreadRunning = true;
+   m_inputThread = new std::thread([this]()
+   {
+      isInputThread = true;
+      SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_ABOVE_NORMAL);
+      DIDEVICEOBJECTDATA didod[INPUT_BUFFER_SIZE]; // Receives buffered data
+      while (m_inputThreadRunning)
+      {
+         GetKeyboardData(didod);
+         GetJoystickData(didod);
+         Sleep(1); // ~1kHz polling, since the player uses the lowest possible timer resolution
+      }
+   });
+   PLOGI << "Input polling thread started";
+#endif
+}
+
+void PinInput::StopInputThread()
+{
+   if (m_inputThread == nullptr)
+      return;
+   m_inputThreadRunning = false;
+   m_inputThread->join();
+   delete m_inputThread;
+   m_inputThread = nullptr;
+   m_threadEventsHead = m_threadEventsTail = 0;
+}
+
 //
 // End of Direct Input specific code
 //
 
-void PinInput::GetInputDeviceData(/*const U32 curr_time_msec*/)
+void PinInput::GetKeyboardData(DIDEVICEOBJECTDATA *didod)
 {
-   DIDEVICEOBJECTDATA didod[INPUT_BUFFER_SIZE]; // Receives buffered data 
-
 #ifdef USE_DINPUT_FOR_KEYBOARD
    // keyboard
 #ifdef USE_DINPUT8
@@ -466,6 +536,34 @@ void PinInput::GetInputDeviceData(/*const U32 curr_time_msec*/)
    }
 #endif
 #endif
+}
+
+void PinInput::GetJoystickData(DIDEVICEOBJECTDATA *didod)
+{
+   switch (m_inputApi) {
+   case 1:
+      HandleInputXI(didod);
+      break;
+   case 2:
+      HandleInputSDL(didod);
+      break;
+   case 3:
+      HandleInputIGC(didod);
+      break;
+   case 0:
+   default:
+      HandleInputDI(didod);
+      break;
+   }
+}
+
+void PinInput::GetInputDeviceData(/*const U32 curr_time_msec*/)
+{
+   DIDEVICEOBJECTDATA didod[INPUT_BUFFER_SIZE]; // Receives buffered data 
+
+   // keyboard (polled by the input thread if any)
+   if (m_inputThread == nullptr)
+      GetKeyboardData(didod);
 
 #ifdef _WIN32
    // mouse
@@ -566,22 +664,13 @@ void PinInput::GetInputDeviceData(/*const U32 curr_time_msec*/)
    }
 #endif
 
-   // same for joysticks 
-   switch (m_inputApi) {
-   case 1:
-      HandleInputXI(didod);
-      break;
-   case 2:
-      HandleInputSDL(didod);
-      break;
-   case 3:
-      HandleInputIGC(didod);
-      break;
-   case 0:
-   default:
-      HandleInputDI(didod);
-      break;
-   }
+   // same for joysticks (polled by the input thread if any)
+#ifdef ENABLE_XINPUT
+   if (m_inputApi == 1)
+      UpdateDeviceXI();
+#endif
+   if (m_inputThread == nullptr)
+      GetJoystickData(didod);
 }
 
 void PinInput::HandleInputDI(DIDEVICEOBJECTDATA *didod)
@@ -636,32 +725,14 @@ void PinInput::HandleInputXI(DIDEVICEOBJECTDATA *didod)
       {XINPUT_GAMEPAD_DPAD_UP, DIJOFS_BUTTON12},
       {XINPUT_GAMEPAD_DPAD_DOWN, DIJOFS_BUTTON13},
       {0, 0} };
+   // The device is selected by UpdateDeviceXI on the main thread, this may run on the input thread
+   const int device = m_inputDeviceXI;
+   if (device < 0)
+      return;
    XINPUT_STATE state = {};
-   unsigned int xie = ERROR_DEVICE_NOT_CONNECTED;
-   if (m_inputDeviceXI != -2 && (m_inputDeviceXI == -1 || (xie = XInputGetState(m_inputDeviceXI, &state)) != ERROR_SUCCESS)) {
-      m_inputDeviceXI = -1;
-      m_num_joy = 0;
-      for (DWORD i = 0; i < XUSER_MAX_COUNT; i++)
-      {
-         ZeroMemory(&state, sizeof(XINPUT_STATE));
-         if ((xie = XInputGetState(i, &state)) == ERROR_SUCCESS) {
-            m_inputDeviceXI = i;
-            m_num_joy = 1;
-            break;
-         }
-      }
-   }
-   if (xie == ERROR_DEVICE_NOT_CONNECTED) { // XInputGetState can cause quite some overhead, especially if no devices connected! Thus disable the polling if nothing connected
-      m_inputDeviceXI = -2;
-      m_num_joy = 0;
-   }
-   if (m_rumbleRunning && m_inputDeviceXI >= 0) {
-      const DWORD now = timeGetTime();
-      if (m_rumbleOffTime <= now || m_rumbleOffTime - now > 65535) {
-         m_rumbleRunning = false;
-         XINPUT_VIBRATION vibration = {};
-         XInputSetState(m_inputDeviceXI, &vibration);
-      }
+   if (XInputGetState(device, &state) != ERROR_SUCCESS) {
+      m_inputDeviceXILost = true; // a new device will be selected by the main thread
+      state = {}; // release all buttons and axes of the lost device
    }
    int i = 0;
    int j = 0;
@@ -720,6 +791,41 @@ void PinInput::HandleInputXI(DIDEVICEOBJECTDATA *didod)
 #endif
 }
 
+// Select the XInput device and stop the rumble when its duration is elapsed. Always called on the main thread.
+void PinInput::UpdateDeviceXI()
+{
+#ifdef ENABLE_XINPUT
+   int device = m_inputDeviceXI;
+   if (m_inputDeviceXILost.exchange(false) && device >= 0)
+      device = -1;
+   if (device == -1) {
+      XINPUT_STATE state;
+      unsigned int xie = ERROR_DEVICE_NOT_CONNECTED;
+      m_num_joy = 0;
+      for (DWORD i = 0; i < XUSER_MAX_COUNT; i++)
+      {
+         ZeroMemory(&state, sizeof(XINPUT_STATE));
+         if ((xie = XInputGetState(i, &state)) == ERROR_SUCCESS) {
+            device = i;
+            m_num_joy = 1;
+            break;
+         }
+      }
+      if (xie == ERROR_DEVICE_NOT_CONNECTED) // XInputGetState can cause quite some overhead, especially if no devices connected! Thus disable the polling if nothing connected
+         device = -2;
+      m_inputDeviceXI = device;
+   }
+   if (m_rumbleRunning && device >= 0) {
+      const DWORD now = timeGetTime();
+      if (m_rumbleOffTime <= now || m_rumbleOffTime - now > 65535) {
+         m_rumbleRunning = false;
+         XINPUT_VIBRATION vibration = {};
+         XInputSetState(device, &vibration);
+      }
+   }
+#endif
+}
+
 void PinInput::HandleInputSDL(DIDEVICEOBJECTDATA *didod)
 {
 #ifdef ENABLE_SDL_INPUT
@@ -829,7 +935,7 @@ void PinInput::PlayRumble(const float lowFrequencySpeed, const float highFrequen
    switch (m_inputApi) {
    case 1: //XInput
 #ifdef ENABLE_XINPUT
-      if (m_inputDeviceXI >= 0) {
+      if (const int device = m_inputDeviceXI; device >= 0) {
          m_rumbleOffTime = ms_duration + timeGetTime();
          m_rumbleRunning = true;
          XINPUT_VIBRATION vibration = {};
@@ -839,7 +945,7 @@ void PinInput::PlayRumble(const float lowFrequencySpeed, const float highFrequen
          // The two motors are not the same, and they create different vibration effects.
          vibration.wLeftMotorSpeed = (WORD)(saturate(lowFrequencySpeed) * 65535.f);
          vibration.wRightMotorSpeed = (WORD)(saturate(highFrequencySpeed) * 65535.f);
-         XInputSetState(m_inputDeviceXI, &vibration);
+         XInputSetState(device, &vibration);
       }
 #endif
       break;
@@ -938,6 +1044,7 @@ void PinInput::Init(const HWND hwnd)
    case 1: //xInput
 #ifdef ENABLE_XINPUT
       m_inputDeviceXI = -1;
+      m_inputDeviceXILost = false;
       uShockType = USHOCKTYPE_GENERIC;
       m_rumbleRunning = false;
 #else
@@ -1001,6 +1108,8 @@ void PinInput::Init(const HWND hwnd)
 
 void PinInput::UnInit()
 {
+   StopInputThread();
+
    m_head = m_tail = 0;
 
 #if defined(ENABLE_SDL_INPUT)
@@ -1873,7 +1982,7 @@ void PinInput::ProcessJoystick(const DIDEVICEOBJECTDATA * __restrict input, int
 }
 
 
-void PinInput::ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec) // last one is negative if only key events should be fired
+void PinInput::ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec, const U64 curr_sim_usec) // curr_time_msec is negative if only key events should be fired
 {
    if (!g_pplayer || !g_pplayer->m_ptable) return; // only if player is running
    g_frameProfiler.OnProcessInput();
@@ -1899,6 +2008,9 @@ void PinInput::ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec) // l
 
    GetInputDeviceData(/*curr_time_msec*/);
 
+   if (m_inputThread)
+      PopInputThreadEvents(curr_sim_usec);
+
    ReadOpenPinballDevices(curr_time_msec);
 
    // Camera/Light tweaking mode (F6) incl. fly-around parameters
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <list>
+#include <atomic>
+#include <thread>
 
 #ifdef _WIN32
 #define ENABLE_XINPUT
@@ -28,6 +30,12 @@
 #error Note that MAX_KEYQUEUE_SIZE must be power of 2
 #endif
 
+#define MAX_INPUT_THREAD_QUEUE_SIZE 256
+
+#if MAX_INPUT_THREAD_QUEUE_SIZE & (MAX_INPUT_THREAD_QUEUE_SIZE-1)
+#error Note that MAX_INPUT_THREAD_QUEUE_SIZE must be power of 2
+#endif
+
 #define USHOCKTYPE_PBWIZARD   1
 #define USHOCKTYPE_ULTRACADE  2
 #define USHOCKTYPE_SIDEWINDER 3
@@ -74,6 +82,10 @@ public:
    void Init(const HWND hwnd);
    void UnInit();
 
+   // Start polling the keyboard and DirectInput/XInput joysticks from a dedicated thread at ~1kHz (if enabled in the settings).
+   // Polled events are timestamped, and only processed once the physics simulation reaches their timestamp.
+   void StartInputThread();
+
    // implicitly sync'd with visuals as each keystroke is applied to the sim
    void FireKeyEvent(const int dispid, int keycode);
 
@@ -81,7 +93,7 @@ public:
    const DIDEVICEOBJECTDATA *GetTail(/*const U32 curr_sim_msec*/);
 
    void ProcessCameraKeys(const DIDEVICEOBJECTDATA * __restrict input);
-   void ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec);
+   void ProcessKeys(/*const U32 curr_sim_msec,*/ int curr_time_msec, const U64 curr_sim_usec = ~0ull); // curr_sim_usec is the (usec() based) time reached by the physics simulation
 
    void ProcessJoystick(const DIDEVICEOBJECTDATA * __restrict input, int curr_time_msec);
 
@@ -143,9 +155,16 @@ private:
 
    void HandleInputDI(DIDEVICEOBJECTDATA *didod);
    void HandleInputXI(DIDEVICEOBJECTDATA *didod);
+   void UpdateDeviceXI();
    void HandleInputSDL(DIDEVICEOBJECTDATA *didod);
    void HandleInputIGC(DIDEVICEOBJECTDATA *didod);
 
+   void GetKeyboardData(DIDEVICEOBJECTDATA *didod);
+   void GetJoystickData(DIDEVICEOBJECTDATA *didod);
+
+   void StopInputThread();
+   void PopInputThreadEvents(const U64 curr_sim_usec);
+
 #ifdef _WIN32
 #ifdef USE_DINPUT8
 #ifdef USE_DINPUT_FOR_KEYBOARD
@@ -201,6 +220,19 @@ private:
 
    int m_tail; // These are integer indices into keyq and should be in domain of 0..MAX_KEYQUEUE_SIZE-1
 
+   // Events polled by the input thread, passed to the main thread through a lock-free single producer/single consumer queue
+   struct TimedInputEvent
+   {
+      DIDEVICEOBJECTDATA data;
+      U64 timestamp; // usec()
+   };
+   TimedInputEvent m_threadEvents[MAX_INPUT_THREAD_QUEUE_SIZE];
+   std::atomic<unsigned int> m_threadEventsHead; // free running counters, head is only written by the input thread, tail by the main thread
+   std::atomic<unsigned int> m_threadEventsTail;
+   std::atomic<bool> m_inputThreadRunning;
+   std::thread *m_inputThread;
+   bool m_useInputThread;
+
    // Axis assignments - these map to the drop-list index in the axis
    // selection combos in the Keys dialog:
    //
@@ -241,7 +273,9 @@ private:
 
 #ifdef _WIN32
 #ifdef ENABLE_XINPUT
-   int m_inputDeviceXI;
+   // The device is selected, and the rumble is managed, on the main thread. The device state may be polled by the input thread.
+   std::atomic<int> m_inputDeviceXI;
+   std::atomic<bool> m_inputDeviceXILost; // set by the polling thread when the selected device could not be read
    XINPUT_STATE m_inputDeviceXIstate;
    DWORD m_rumbleOffTime;
    bool m_rumbleRunning;
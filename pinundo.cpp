@@ -6,6 +6,7 @@ PinUndo::PinUndo()
    m_cUndoLayer = 0;
    m_sdsDirty = eSaveClean;
    m_cleanpoint = 0;
+   m_memoryUsage = 0;
 }
 
 PinUndo::~PinUndo()
@@ -31,16 +32,24 @@ void PinUndo::BeginUndo()
 
    if (m_cUndoLayer == 1)
    {
-      if (m_vur.size() == MAXUNDO)
-      {
-         delete m_vur[0];
-         m_vur.erase(m_vur.begin());
-         m_cleanpoint--;
-      }
-
       UndoRecord * const pur = new UndoRecord();
 
       m_vur.push_back(pur);
+
+      PruneHistory();
+   }
+}
+
+// Drop the oldest undo steps until the history fits in the memory budget (the last step is always kept)
+void PinUndo::PruneHistory()
+{
+   const size_t budget = (size_t)max(m_ptable->m_settings.LoadValueWithDefault(Settings::Editor, "UndoMemoryBudget"s, 64), 1) * (1024 * 1024);
+   while (m_vur.size() > 1 && (m_vur.size() > MAXUNDO || m_memoryUsage > budget))
+   {
+      m_memoryUsage -= m_vur[0]->GetReleasableMemory();
+      delete m_vur[0];
+      m_vur.erase(m_vur.begin());
+      m_cleanpoint--;
    }
 }
 
@@ -63,7 +72,12 @@ void PinUndo::MarkForUndo(IEditable * const pie, const bool saveForUndo)
 
    UndoRecord * const pur = m_vur[m_vur.size() - 1];
 
-   pur->MarkForUndo(pie, saveForUndo);
+   // Look for the last saved state of this editable, to share the records that did not change since then
+   const UndoSnapshot *previous = nullptr;
+   for (size_t i = m_vur.size() - 1; i > 0 && previous == nullptr; i--)
+      previous = m_vur[i - 1]->FindSnapshot(pie);
+
+   m_memoryUsage += pur->MarkForUndo(pie, saveForUndo, previous);
 }
 
 void PinUndo::MarkForCreate(IEditable * const pie)
@@ -133,31 +147,35 @@ void PinUndo::Undo()
 
    pur->m_vieDelete.clear(); // Don't want these released when this record gets deleted
 
-   for (size_t i = 0; i < pur->m_vstm.size(); i++)
+   for (const UndoSnapshot &snapshot : pur->m_vsnapshot)
    {
-      IStream * const pstm = pur->m_vstm[i];
+      FastIStream * const pstm = new FastIStream();
+      pstm->AddRef();
+
+      DWORD write;
+      for (const FastIStreamData &record : snapshot.m_records)
+         pstm->Write(record->data(), (ULONG)record->size(), &write);
 
       // Go back to beginning of stream to load
       LARGE_INTEGER foo;
       foo.QuadPart = 0;
       pstm->Seek(foo, STREAM_SEEK_SET, nullptr);
 
-      DWORD read;
-      IEditable *pie;
-      pstm->Read(&pie, sizeof(IEditable *), &read);
-
+      IEditable * const pie = snapshot.m_pie;
       pie->ClearForOverwrite();
 
       int foo2;
       pie->InitLoad(pstm, m_ptable, &foo2, CURRENT_FILE_FORMAT_VERSION, 0, 0);
       pie->InitPostLoad();
-      // Stream gets released when undo record is deleted
-      //pstm->Release();
+      pie->m_autoSaveData.reset();
+
+      pstm->Release();
    }
 
    for (size_t i = 0; i<pur->m_vieCreate.size(); i++)
       m_ptable->Uncreate(pur->m_vieCreate[i]);
 
+   m_memoryUsage -= pur->GetReleasableMemory();
    RemoveFromVectorSingle(m_vur, pur);
    delete pur;
 
@@ -189,6 +207,13 @@ void PinUndo::EndUndo()
       m_cUndoLayer--;
    }
 
+   // items may have been modified after being marked (e.g. while dragging), so invalidate them again once the undo step is complete
+   if (m_cUndoLayer == 0 && !m_vur.empty())
+      m_vur.back()->InvalidateAutoSaveData();
+
+   if (m_cUndoLayer == 0)
+      PruneHistory();
+
    if (m_cUndoLayer == 0 && (m_sdsDirty < eSaveDirty))
    {
       m_sdsDirty = eSaveDirty;
@@ -202,32 +227,95 @@ UndoRecord::UndoRecord()
 
 UndoRecord::~UndoRecord()
 {
-   for (size_t i = 0; i < m_vstm.size(); i++)
-      m_vstm[i]->Release();
-
    for (size_t i = 0; i < m_vieDelete.size(); i++)
       m_vieDelete[i]->Release();
 }
 
-void UndoRecord::MarkForUndo(IEditable * const pie, const bool saveForUndo)
+// Returns the amount of newly allocated memory (records not shared with the previous snapshot)
+size_t UndoRecord::MarkForUndo(IEditable * const pie, const bool saveForUndo, const UndoSnapshot * const previous)
 {
    if (FindIndexOf(m_vieMark, pie) != -1) // Been marked already
-      return;
+      return 0;
 
    if (FindIndexOf(m_vieCreate, pie) != -1) // Just created, so undo will delete it anyway
-      return;
+      return 0;
 
    m_vieMark.push_back(pie);
+   pie->m_autoSaveData.reset();
 
    FastIStream * const pstm = new FastIStream();
    pstm->AddRef();
 
-   DWORD write;
-   pstm->Write(&pie, sizeof(IEditable *), &write);
-
    pie->SaveData(pstm, 0, true);
 
-   m_vstm.push_back(pstm);
+   // Records of the previous snapshot, by content (each one is only reused once, so that a record is never shared inside a snapshot)
+   robin_hood::unordered_map<size_t, FastIStreamData> previousRecords;
+   if (previous)
+      for (const FastIStreamData &record : previous->m_records)
+         previousRecords.emplace(robin_hood::hash_bytes(record->data(), record->size()), record);
+
+   // Split the data into its BIFF records (size, tag, data)
+   UndoSnapshot snapshot;
+   snapshot.m_pie = pie;
+   size_t allocated = 0;
+   for (unsigned int pos = 0; pos < pstm->m_cSize;)
+   {
+      const char * const data = pstm->m_rg + pos;
+      unsigned int len = pstm->m_cSize - pos; // By default, keep the remaining data as a single block
+      if (len >= 2 * sizeof(int))
+      {
+         int size, tag;
+         memcpy(&size, data, sizeof(int));
+         memcpy(&tag, data + sizeof(int), sizeof(int));
+         // Fonts are saved as raw data following their tag, so the rest of the stream can not be split
+         if (tag != FID(FONT) && size >= (int)sizeof(int) && (unsigned int)size <= len - sizeof(int))
+            len = (unsigned int)sizeof(int) + size;
+      }
+
+      const auto it = previousRecords.find(robin_hood::hash_bytes(data, len));
+      if (it != previousRecords.end() && it->second->size() == len && memcmp(it->second->data(), data, len) == 0)
+      {
+         snapshot.m_records.push_back(it->second);
+         previousRecords.erase(it);
+      }
+      else
+      {
+         snapshot.m_records.push_back(std::make_shared<const vector<char>>(data, data + len));
+         allocated += len;
+      }
+      pos += len;
+   }
+
+   pstm->Release();
+
+   m_vsnapshot.push_back(std::move(snapshot));
+
+   return allocated;
+}
+
+const UndoSnapshot *UndoRecord::FindSnapshot(const IEditable * const pie) const
+{
+   for (const UndoSnapshot &snapshot : m_vsnapshot)
+      if (snapshot.m_pie == pie)
+         return &snapshot;
+   return nullptr;
+}
+
+// Amount of memory that will be freed when deleting this record (records not shared with another undo record)
+size_t UndoRecord::GetReleasableMemory() const
+{
+   size_t size = 0;
+   for (const UndoSnapshot &snapshot : m_vsnapshot)
+      for (const FastIStreamData &record : snapshot.m_records)
+         if (record.use_count() == 1)
+            size += record->size();
+   return size;
+}
+
+void UndoRecord::InvalidateAutoSaveData()
+{
+   for (IEditable *const pie : m_vieMark)
+      pie->m_autoSaveData.reset();
 }
 
 void UndoRecord::MarkForCreate(IEditable * const pie)
@@ -5,22 +5,34 @@
 #if !defined(AFX_PINUNDO_H__F1136F22_51FB_4AC8_B7FC_89A5E148DD7B__INCLUDED_)
 #define AFX_PINUNDO_H__F1136F22_51FB_4AC8_B7FC_89A5E148DD7B__INCLUDED_
 
-#define MAXUNDO 16
+#define MAXUNDO 256 // Hard limit on the number of undo steps, the memory budget (see PinUndo::PruneHistory) is usually reached first
 
 class IEditable;
 class PinTable;
 
+// Saved state of an editable, stored as the list of its BIFF records.
+// Records which are unchanged from the previous snapshot of the same editable are shared with it instead of being copied.
+struct UndoSnapshot
+{
+   IEditable *m_pie;
+   vector<FastIStreamData> m_records;
+};
+
 class UndoRecord
 {
 public:
    UndoRecord();
    virtual ~UndoRecord();
 
-   void MarkForUndo(IEditable *const pie, const bool saveForUndo);
+   size_t MarkForUndo(IEditable *const pie, const bool saveForUndo, const UndoSnapshot *const previous);
    void MarkForCreate(IEditable *const pie);
    void MarkForDelete(IEditable *const pie);
+   void InvalidateAutoSaveData();
 
-   vector<FastIStream*> m_vstm;
+   const UndoSnapshot *FindSnapshot(const IEditable *const pie) const;
+   size_t GetReleasableMemory() const;
+
+   vector<UndoSnapshot> m_vsnapshot;
    vector<IEditable*> m_vieCreate;
    vector<IEditable*> m_vieDelete;
 
@@ -46,8 +58,12 @@ public:
    PinTable *m_ptable;
 
 private:
+   void PruneHistory();
+
    vector<UndoRecord*> m_vur;
 
+   size_t m_memoryUsage; // Size of the record data held by the undo history
+
    int m_cUndoLayer;
 
    SaveDirtyState m_sdsDirty; // Dirty flag for saving on close
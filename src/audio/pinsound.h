@@ -126,6 +126,8 @@ public:
    char *m_pdata; // wav: copy of the buffer/sample data so we can save it out, else: the contents of the original file
    int m_cdata;
 
+   FastIStreamData m_autoSaveData; // data of the last autosave, reused until the table sounds get modified (see PinTable::SaveToStorage)
+
    // old wav code only, but also used to convert raw wavs back to BASS
    WAVEFORMATEX m_wfx;
 
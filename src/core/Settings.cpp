@@ -23,6 +23,52 @@ Settings::Section Settings::GetSection(const string& name)
    return Count;
 }
 
+static const struct
+{
+   Settings::Section section;
+   string name;
+   Settings::KeyType type;
+   int defInt;
+   float defFloat;
+} keyDefs[Settings::KeyCount] =
+{
+   #define SETTINGS_KEY_DEF(section, name, type, def) { Settings::section, string(#name), Settings::KT_##type, (int)(def), (float)(def) },
+   SETTINGS_REGISTRY(SETTINGS_KEY_DEF)
+   #undef SETTINGS_KEY_DEF
+};
+
+Settings::KeyType Settings::GetKeyType(const Key key)
+{
+   return keyDefs[key].type;
+}
+
+uint32_t Settings::GetCachedValue(const Key key) const
+{
+   // Modifications only bump the version (summed with the parent ones), outdated values are resolved again on their next lookup
+   const unsigned int version = GetVersion();
+   std::atomic<uint64_t> &entry = m_cache[key].packed;
+   const uint64_t packed = entry.load(std::memory_order_relaxed);
+   if ((unsigned int)(packed >> 32) == version)
+      return (uint32_t)packed;
+   const auto &def = keyDefs[key];
+   uint32_t value;
+   if (def.type == KT_Float)
+   {
+      const float f = LoadValueWithDefault(def.section, def.name, def.defFloat);
+      memcpy(&value, &f, sizeof(float));
+   }
+   else
+      value = (uint32_t)LoadValueWithDefault(def.section, def.name, def.defInt);
+   entry.store(((uint64_t)version << 32) | value, std::memory_order_relaxed);
+   return value;
+}
+
+void Settings::InvalidateCache()
+{
+   for (CachedValue &value : m_cache)
+      value.packed.store(~0ull, std::memory_order_relaxed);
+}
+
 Settings::Settings(const Settings* parent)
    : m_parent(parent)
 {
@@ -31,6 +77,7 @@ Settings::Settings(const Settings* parent)
 bool Settings::LoadFromFile(const string& path, const bool createDefault)
 {
    m_modified = false;
+   m_version++;
    m_iniPath = path;
    mINI::INIFile file(path);
    if (file.read(m_ini))
@@ -204,6 +251,7 @@ void Settings::CopyOverrides(const Settings& settings)
          }
       }
    }
+   m_version++;
 }
 
 bool Settings::HasValue(const Section section, const string& key, const bool searchParent) const
@@ -351,12 +399,14 @@ bool Settings::SaveValue(const Section section, const string &key, const DataTyp
          if (m_ini.get(regKey[section]).has(key))
          {
             m_modified = true;
+            m_version++;
             m_ini[regKey[section]].remove(key);
          }
          return true;
       }
    }
    m_modified = true;
+   m_version++;
    m_ini[regKey[section]][key] = copy;
    return true;
 }
@@ -397,6 +447,7 @@ bool Settings::DeleteValue(const Section section, const string &key, const bool
    if (m_ini.get(regKey[section]).has(key))
    {
       m_modified = true;
+      m_version++;
       success &= m_ini[regKey[section]].remove(key);
    }
    return success;
@@ -410,6 +461,7 @@ bool Settings::DeleteSubKey(const Section section, const bool deleteFromParent)
    if (m_ini.has(regKey[section]))
    {
       m_modified = true;
+      m_version++;
       success &= m_ini.remove(regKey[section]);
    }
    return success;
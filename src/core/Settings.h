@@ -2,6 +2,7 @@
 
 #define MINI_CASE_SENSITIVE
 #include "mINI/ini.h"
+#include <atomic>
 
 // This class holds the settings registry.
 // A setting registry can have a parent, in which case, missing settings will be looked for in the parent.
@@ -12,7 +13,7 @@ class Settings final
 public:
    Settings(const Settings* parent = nullptr);
 
-   void SetParent(const Settings *parent) { m_parent = parent; }
+   void SetParent(const Settings *parent) { m_parent = parent; InvalidateCache(); }
 
    void SetIniPath(const string &path) { m_iniPath = path; }
    bool LoadFromFile(const string &path, const bool createDefault);
@@ -67,6 +68,97 @@ public:
 
    static Section GetSection(const string& szName);
 
+   // Typed settings registry: each setting is declared once with its section, name, type and default value, and resolved to a
+   // numeric id at compile time. Values are parsed on first access and cached until the settings (or their parent) are modified.
+   // Settings whose default value depends on the context are still accessed through LoadValue/LoadValueWithDefault.
+   #define SETTINGS_REGISTRY(X) \
+      X(Player, BallTrail, Bool, true) \
+      X(Player, BallTrailStrength, Float, 0.5f) \
+      X(Player, DisableLightingForBalls, Bool, false) \
+      X(Player, DisableDWM, Bool, false) \
+      X(Player, UseNVidiaAPI, Bool, false) \
+      X(Player, Stereo3DFake, Bool, false) \
+      X(Player, BWRendering, Int, 0) \
+      X(Player, DetectHang, Bool, false) \
+      X(Player, PFReflection, Int, -1) \
+      X(Player, BallReflection, Bool, true) \
+      X(Player, PFRefl, Bool, true) \
+      X(Player, MaxPrerenderedFrames, Int, 0) \
+      X(Player, NudgeStrength, Float, 2e-2f) \
+      X(Player, Sharpen, Int, 0) \
+      X(Player, MSAASamples, Int, 1) \
+      X(Player, DynamicAO, Bool, true) \
+      X(Player, DisableAO, Bool, false) \
+      X(Player, SSRefl, Bool, false) \
+      X(Player, ScaleFXDMD, Bool, false) \
+      X(Player, ForceBloomOff, Bool, false) \
+      X(Player, MaxFramerate, Int, -1) \
+      X(Player, AdaptiveVSync, Int, -1) \
+      X(Player, OverwriteBallImage, Bool, false) \
+      X(Player, MinPhysLoopTime, Int, 0) \
+      X(Player, BallSpatialHash, Bool, false) \
+      X(Player, MaxTexDimension, Int, 0) \
+      X(Player, CacheMode, Int, 1) \
+      X(Player, PrecomputeMipmaps, Bool, false) \
+      X(Player, ForceAnisotropicFiltering, Bool, true) \
+      X(Player, PlayMusic, Bool, true) \
+      X(Player, PlaySound, Bool, true) \
+      X(Player, MusicVolume, Int, 100) \
+      X(Player, SoundVolume, Int, 100) \
+      X(Player, OverrideTableEmissionScale, Bool, false) \
+      X(Player, DynamicDayNight, Bool, false) \
+      X(Player, Latitude, Float, 52.52f) \
+      X(Player, Longitude, Float, 13.37f) \
+      X(Player, EmissionScale, Float, 0.5f) \
+      X(Player, EnableLegacyNudge, Bool, false) \
+      X(Player, LegacyNudgeStrength, Float, 1.f) \
+      X(Player, AccelVelocityInput, Bool, false) \
+      X(Player, PlungerSpeedScale, Float, 100.f) \
+      X(Player, BallAntiStretch, Bool, false) \
+      X(Player, EnableCameraModeFlyAround, Bool, false) \
+      X(Player, ScreenPlayerX, Float, 0.f) \
+      X(Player, ScreenPlayerY, Float, 0.f) \
+      X(Player, ScreenPlayerZ, Float, 70.f) \
+      X(Player, ScreenInclination, Float, 0.f) \
+      X(Player, ScreenWidth, Float, 0.f) \
+      X(Player, ScreenHeight, Float, 0.f) \
+      X(Player, Stereo3DYAxis, Bool, false) \
+      X(Player, Stereo3DEyeSeparation, Float, 63.f) \
+      X(Player, Stereo3DMaxSeparation, Float, 0.03f) \
+      X(Player, Stereo3DBrightness, Float, 1.f) \
+      X(Player, Stereo3DSaturation, Float, 1.f) \
+      X(Player, Stereo3DLeftContrast, Float, 1.f) \
+      X(Player, Stereo3DRightContrast, Float, 1.f) \
+      X(Player, Stereo3DDefocus, Float, 0.f) \
+      X(PlayerVR, ShrinkPreview, Bool, false) \
+      X(PlayerVR, TweakUI_X, Int, 450) \
+      X(PlayerVR, TweakUI_Y, Int, 300) \
+      X(Editor, ThrowBallsAlwaysOn, Bool, false) \
+      X(Editor, BallControlAlwaysOn, Bool, false) \
+      X(Editor, ThrowBallSize, Int, 50) \
+      X(Editor, ThrowBallMass, Float, 1.f)
+
+   enum Key
+   {
+      #define SETTINGS_KEY(section, name, type, def) section##_##name,
+      SETTINGS_REGISTRY(SETTINGS_KEY)
+      #undef SETTINGS_KEY
+      KeyCount
+   };
+
+   enum KeyType
+   {
+      KT_Bool,
+      KT_Int,
+      KT_Float
+   };
+
+   bool LoadBool(const Key key) const { assert(GetKeyType(key) == KT_Bool); return GetCachedValue(key) != 0; }
+   int LoadInt(const Key key) const { assert(GetKeyType(key) == KT_Int); return (int)GetCachedValue(key); }
+   float LoadFloat(const Key key) const { assert(GetKeyType(key) == KT_Float); const uint32_t v = GetCachedValue(key); float f; memcpy(&f, &v, sizeof(float)); return f; }
+
+   static KeyType GetKeyType(const Key key);
+
    bool HasValue(const Section section, const string &key, const bool searchParent = false) const;
 
    bool LoadValue(const Section section, const string &key, string &buffer) const;
@@ -117,6 +209,23 @@ private:
 
    vector<OptionDef> m_options;
 
+   // Incremented each time the ini data is modified, summed with the parent ones to detect outdated cached values
+   unsigned int GetVersion() const { return m_version + (m_parent ? m_parent->GetVersion() : 0); }
+   unsigned int m_version = 0;
+
+   // Value of a registered key (int, or float bits) packed with the version it was resolved for, in a single atomic so that
+   // lookups can lazily (re)fill it from any thread. Copies start invalid, since they may be used with another parent.
+   struct CachedValue
+   {
+      CachedValue() = default;
+      CachedValue(const CachedValue &) { }
+      CachedValue &operator=(const CachedValue &) { packed.store(~0ull, std::memory_order_relaxed); return *this; }
+      std::atomic<uint64_t> packed { ~0ull };
+   };
+   uint32_t GetCachedValue(const Key key) const;
+   void InvalidateCache();
+   mutable CachedValue m_cache[KeyCount];
+
    bool m_modified = false;
    string m_iniPath;
    mINI::INIStructure m_ini;
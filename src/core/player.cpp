@@ -11,6 +11,7 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <ctime>
 #include <fstream>
 #include <sstream>
@@ -26,6 +27,7 @@
 #include "winsdk/legacy_touch.h"
 #endif
 #include "tinyxml2/tinyxml2.h"
+#include "ThreadPool.h"
 
 #if __cplusplus >= 202002L && !defined(__clang__)
 #define stable_sort std::ranges::stable_sort
@@ -136,30 +138,30 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
    m_capPUP = false;
 #endif
    m_vrPreview = (VRPreviewMode)m_ptable->m_settings.LoadValueWithDefault(Settings::PlayerVR, "VRPreview"s, (int)VRPREVIEW_LEFT);
-   m_vrPreviewShrink = m_ptable->m_settings.LoadValueWithDefault(Settings::PlayerVR, "ShrinkPreview"s, false);
-   m_trailForBalls = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BallTrail"s, true);
-   m_ballTrailStrength = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BallTrailStrength"s, 0.5f);
-   m_disableLightingForBalls = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "DisableLightingForBalls"s, false);
+   m_vrPreviewShrink = m_ptable->m_settings.LoadBool(Settings::PlayerVR_ShrinkPreview);
+   m_trailForBalls = m_ptable->m_settings.LoadBool(Settings::Player_BallTrail);
+   m_ballTrailStrength = m_ptable->m_settings.LoadFloat(Settings::Player_BallTrailStrength);
+   m_disableLightingForBalls = m_ptable->m_settings.LoadBool(Settings::Player_DisableLightingForBalls);
    m_stereo3D = useVR ? STEREO_VR : (StereoMode)m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3D"s, (int)STEREO_OFF);
    m_stereo3Denabled = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DEnabled"s, (m_stereo3D != STEREO_OFF));
-   m_disableDWM = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "DisableDWM"s, false);
-   m_useNvidiaApi = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "UseNVidiaAPI"s, false);
-   m_stereo3DfakeStereo = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DFake"s, false);
+   m_disableDWM = m_ptable->m_settings.LoadBool(Settings::Player_DisableDWM);
+   m_useNvidiaApi = m_ptable->m_settings.LoadBool(Settings::Player_UseNVidiaAPI);
+   m_stereo3DfakeStereo = m_ptable->m_settings.LoadBool(Settings::Player_Stereo3DFake);
    #ifndef ENABLE_SDL // DirectX does not support stereo rendering
    m_stereo3DfakeStereo = true;
    #endif
    m_headTracking = useVR ? false : m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BAMHeadTracking"s, false);
-   m_BWrendering = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BWRendering"s, 0);
-   m_detectScriptHang = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "DetectHang"s, false);
-   const int maxReflection = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "PFReflection"s, -1);
+   m_BWrendering = m_ptable->m_settings.LoadInt(Settings::Player_BWRendering);
+   m_detectScriptHang = m_ptable->m_settings.LoadBool(Settings::Player_DetectHang);
+   const int maxReflection = m_ptable->m_settings.LoadInt(Settings::Player_PFReflection);
    if (maxReflection != -1)
       m_maxReflectionMode = (RenderProbe::ReflectionMode)maxReflection;
    else
    {
       m_maxReflectionMode = RenderProbe::REFL_STATIC;
-      if (m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BallReflection"s, true))
+      if (m_ptable->m_settings.LoadBool(Settings::Player_BallReflection))
          m_maxReflectionMode = RenderProbe::REFL_STATIC_N_BALLS;
-      if (m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "PFRefl"s, true))
+      if (m_ptable->m_settings.LoadBool(Settings::Player_PFRefl))
          m_maxReflectionMode = RenderProbe::REFL_STATIC_N_DYNAMIC;
    }
    // For dynamic mode, static reflections are not available so adapt the mode
@@ -169,30 +171,30 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
    // Apply table specific overrides
    m_toneMapper = (ToneMapper)m_ptable->m_settings.LoadValueWithDefault(Settings::TableOverride, "ToneMapper"s, m_ptable->GetToneMapper());
 
-   m_maxPrerenderedFrames = useVR ? 0 : m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MaxPrerenderedFrames"s, 0);
+   m_maxPrerenderedFrames = useVR ? 0 : m_ptable->m_settings.LoadInt(Settings::Player_MaxPrerenderedFrames);
 
-   m_NudgeShake = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "NudgeStrength"s, 2e-2f);
-   m_sharpen = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Sharpen"s, 0);
+   m_NudgeShake = m_ptable->m_settings.LoadFloat(Settings::Player_NudgeStrength);
+   m_sharpen = m_ptable->m_settings.LoadInt(Settings::Player_Sharpen);
    m_FXAA = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "FXAA"s, (int)Disabled);
 #ifdef ENABLE_SDL
-   m_MSAASamples = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MSAASamples"s, 1);
+   m_MSAASamples = m_ptable->m_settings.LoadInt(Settings::Player_MSAASamples);
 #else
    // Sadly DX9 does not support resolving an MSAA depth buffer, making MSAA implementation complex for it. So just disable for now
    m_MSAASamples = 1;
 #endif
    m_AAfactor = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "AAFactor"s, m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "USEAA"s, false) ? 2.0f : 1.0f);
-   m_dynamicAO = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "DynamicAO"s, true);
-   m_disableAO = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "DisableAO"s, false);
-   m_ss_refl = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "SSRefl"s, false);
-   m_scaleFX_DMD = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ScaleFXDMD"s, false);
-   m_bloomOff = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ForceBloomOff"s, false);
-   m_maxFramerate = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MaxFramerate"s, -1);
+   m_dynamicAO = m_ptable->m_settings.LoadBool(Settings::Player_DynamicAO);
+   m_disableAO = m_ptable->m_settings.LoadBool(Settings::Player_DisableAO);
+   m_ss_refl = m_ptable->m_settings.LoadBool(Settings::Player_SSRefl);
+   m_scaleFX_DMD = m_ptable->m_settings.LoadBool(Settings::Player_ScaleFXDMD);
+   m_bloomOff = m_ptable->m_settings.LoadBool(Settings::Player_ForceBloomOff);
+   m_maxFramerate = m_ptable->m_settings.LoadInt(Settings::Player_MaxFramerate);
    if(m_maxFramerate > 0 && m_maxFramerate < 24) // at least 24 fps
       m_maxFramerate = 24;
    m_videoSyncMode = (VideoSyncMode)m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "SyncMode"s, VSM_INVALID);
    if (m_maxFramerate < 0 && m_videoSyncMode == VideoSyncMode::VSM_INVALID)
    {
-      const int vsync = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "AdaptiveVSync"s, -1);
+      const int vsync = m_ptable->m_settings.LoadInt(Settings::Player_AdaptiveVSync);
       switch (vsync)
       {
       case -1: m_maxFramerate = 0; m_videoSyncMode = VideoSyncMode::VSM_FRAME_PACING; break;
@@ -217,8 +219,11 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
    m_ballImage = nullptr;
    m_decalImage = nullptr;
 
-   m_overwriteBallImages = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "OverwriteBallImage"s, false);
-   m_minphyslooptime = min(m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MinPhysLoopTime"s, 0), 1000);
+   m_overwriteBallImages = m_ptable->m_settings.LoadBool(Settings::Player_OverwriteBallImage);
+   m_minphyslooptime = min(m_ptable->m_settings.LoadInt(Settings::Player_MinPhysLoopTime), 1000);
+#ifndef USE_EMBREE
+   m_ballSpatialHash = m_ptable->m_settings.LoadBool(Settings::Player_BallSpatialHash);
+#endif
 
    if (m_overwriteBallImages)
    {
@@ -226,7 +231,7 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
        bool hr = m_ptable->m_settings.LoadValue(Settings::Player, "BallImage"s, imageName);
        if (hr)
        {
-         BaseTexture *const tex = BaseTexture::CreateFromFile(imageName, m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MaxTexDimension"s, 0));
+         BaseTexture *const tex = BaseTexture::CreateFromFile(imageName, m_ptable->m_settings.LoadInt(Settings::Player_MaxTexDimension));
 
            if (tex != nullptr)
                m_ballImage = new Texture(tex);
@@ -234,17 +239,17 @@ Player::Player(PinTable *const editor_table, PinTable *const live_table, const i
        hr = m_ptable->m_settings.LoadValue(Settings::Player, "DecalImage"s, imageName);
        if (hr)
        {
-           BaseTexture *const tex = BaseTexture::CreateFromFile(imageName, m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MaxTexDimension"s, 0));
+           BaseTexture *const tex = BaseTexture::CreateFromFile(imageName, m_ptable->m_settings.LoadInt(Settings::Player_MaxTexDimension));
 
            if (tex != nullptr)
                m_decalImage = new Texture(tex);
        }
    }
 
-   m_throwBalls = m_ptable->m_settings.LoadValueWithDefault(Settings::Editor, "ThrowBallsAlwaysOn"s, false);
-   m_ballControl = m_ptable->m_settings.LoadValueWithDefault(Settings::Editor, "BallControlAlwaysOn"s, false);
-   m_debugBallSize = m_ptable->m_settings.LoadValueWithDefault(Settings::Editor, "ThrowBallSize"s, 50);
-   m_debugBallMass = m_ptable->m_settings.LoadValueWithDefault(Settings::Editor, "ThrowBallMass"s, 1.0f);
+   m_throwBalls = m_ptable->m_settings.LoadBool(Settings::Editor_ThrowBallsAlwaysOn);
+   m_ballControl = m_ptable->m_settings.LoadBool(Settings::Editor_BallControlAlwaysOn);
+   m_debugBallSize = m_ptable->m_settings.LoadInt(Settings::Editor_ThrowBallSize);
+   m_debugBallMass = m_ptable->m_settings.LoadFloat(Settings::Editor_ThrowBallMass);
 
    const int numberOfTimesToShowTouchMessage = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "NumberOfTimesToShowTouchMessage"s, 10);
    g_pvp->m_settings.SaveValue(Settings::Player, "NumberOfTimesToShowTouchMessage"s, max(numberOfTimesToShowTouchMessage - 1, 0));
@@ -710,11 +715,12 @@ void Player::OnClose()
     // In Windows 10 1803, there may be a significant lag waiting for WM_DESTROY (msg sent by the delete call below) if script is not closed first.
     // signal the script that the game is now exited to allow any cleanup
     m_ptable->FireVoidEvent(DISPID_GameEvents_Exit);
+    m_scriptEventQueue.Clear();
     if (m_detectScriptHang)
         g_pvp->PostWorkToWorkerThread(HANG_SNOOP_STOP, NULL);
 
    // Save list of used textures to avoid stuttering in next play
-   if ((m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "CacheMode"s, 1) > 0) && FileExists(m_ptable->m_szFileName))
+   if ((m_ptable->m_settings.LoadInt(Settings::Player_CacheMode) > 0) && FileExists(m_ptable->m_szFileName))
    {
       string dir = g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + m_ptable->m_szTitle + PATH_SEPARATOR_CHAR;
       std::filesystem::create_directories(std::filesystem::path(dir));
@@ -750,7 +756,7 @@ void Player::OnClose()
       {
          for (Texture *image : m_ptable->m_vimage)
          {
-            if (image->m_szName.length() > 0 && image->m_pdsBuffer == memtex)
+            if (image->m_szName.length() > 0 && image->GetRawBitmapIfDecoded() == memtex)
             {
                tinyxml2::XMLElement *node = xmlDoc.NewElement("texture");
                node->SetText(image->m_szName.c_str());
@@ -883,7 +889,7 @@ void Player::OnClose()
       delete m_controlclsidsafe[i];
    m_controlclsidsafe.clear();
 
-   m_changed_vht.clear();
+   m_timers.Clear();
 
    g_pplayer = nullptr;
 
@@ -1134,7 +1140,7 @@ void Player::UpdateStereoShaderState()
       stereoMVP.GetModelViewProj(1).TransformVertices(&deepPt, nullptr, 1, &projRight, viewport);*/
       const float eyeSeparation = m_ptable->GetMaxSeparation();
       const float zpd = m_ptable->GetZPD();
-      const bool swapAxis = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DYAxis"s, false); // Swap X/Y axis
+      const bool swapAxis = m_ptable->m_settings.LoadBool(Settings::Player_Stereo3DYAxis); // Swap X/Y axis
       m_pin3d.m_pd3dPrimaryDevice->StereoShader->SetVector(SHADER_Stereo_MS_ZPD_YAxis, eyeSeparation, zpd, swapAxis ? 1.0f : 0.0f, 0.0f);
    }
    
@@ -1151,7 +1157,7 @@ void Player::UpdateStereoShaderState()
       anaglyph.LoadSetupFromRegistry(clamp(m_stereo3D - STEREO_ANAGLYPH_1, 0, 9));
       anaglyph.SetupShader(m_pin3d.m_pd3dPrimaryDevice->StereoShader);
       // The defocus kernel size should depend on the render resolution but since this is a user tweak, this doesn't matter that much
-      m_stereo3DDefocus = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DDefocus"s, 0.f);
+      m_stereo3DDefocus = m_ptable->m_settings.LoadFloat(Settings::Player_Stereo3DDefocus);
       // TODO I'm not 100% sure about this. I think the right way would be to select based on the transmitted luminance of the filter, the defocus 
       // being done on the lowest of the 2. Here we do on the single color channel, which is the same most of the time but not always (f.e. green/magenta)
       if (anaglyph.IsReversedColorPair())
@@ -1231,24 +1237,55 @@ HRESULT Player::Init()
 
    InitKeys();
 
-   m_PlayMusic = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "PlayMusic"s, true);
-   m_PlaySound = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "PlaySound"s, true);
-   m_MusicVolume = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "MusicVolume"s, 100);
-   m_SoundVolume = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "SoundVolume"s, 100);
+   // With lazy image decoding, images are still compressed at this point: decode the ones used by the table in parallel
+   // (others, like images only set by script, will be decoded on first use)
+   // Optionally also precompute their sRGB correct mipmaps on the CPU, to be uploaded with the textures instead of generating them on the GPU
+   {
+      const U64 decodeStart = usec();
+#ifdef ENABLE_SDL
+      const bool precomputeMipmaps = m_ptable->m_settings.LoadBool(Settings::Player_PrecomputeMipmaps);
+#else
+      const bool precomputeMipmaps = false; // DX9 path generates the mipmaps of system textures on the CPU already
+#endif
+      vector<Texture *> usedImages;
+      m_ptable->GetUsedImages(usedImages);
+      ThreadPool pool(g_pvp->m_logicalNumberOfProcessors);
+      int nDecoded = 0;
+      for (Texture *const image : usedImages)
+      {
+         const bool decode = image->GetRawBitmapIfDecoded() == nullptr && image->IsLoaded();
+         if (decode || precomputeMipmaps)
+            pool.enqueue([image, precomputeMipmaps] {
+               BaseTexture *const bitmap = image->GetRawBitmap();
+               if (precomputeMipmaps && bitmap)
+                  bitmap->GenerateMipmaps();
+            });
+         if (decode)
+            nDecoded++;
+      }
+      pool.wait_until_nothing_in_flight();
+      if (nDecoded > 0 || precomputeMipmaps)
+         PLOGI << nDecoded << " images decoded" << (precomputeMipmaps ? " and mipmaps precomputed" : "") << " in " << ((usec() - decodeStart) / 1000) << "ms"; // For profiling
+   }
+
+   m_PlayMusic = m_ptable->m_settings.LoadBool(Settings::Player_PlayMusic);
+   m_PlaySound = m_ptable->m_settings.LoadBool(Settings::Player_PlaySound);
+   m_MusicVolume = m_ptable->m_settings.LoadInt(Settings::Player_MusicVolume);
+   m_SoundVolume = m_ptable->m_settings.LoadInt(Settings::Player_SoundVolume);
 
    // Global emission scale
    m_globalEmissionScale = m_ptable->m_globalEmissionScale;
-   if (m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "OverrideTableEmissionScale"s, false))
+   if (m_ptable->m_settings.LoadBool(Settings::Player_OverrideTableEmissionScale))
    { // Overriden from settings
-      if (m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "DynamicDayNight"s, false))
+      if (m_ptable->m_settings.LoadBool(Settings::Player_DynamicDayNight))
       {
          time_t hour_machine;
          time(&hour_machine);
          tm local_hour;
          localtime_s(&local_hour, &hour_machine);
 
-         const float lat = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Latitude"s, 52.52f);
-         const float lon = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "Longitude"s, 13.37f);
+         const float lat = m_ptable->m_settings.LoadFloat(Settings::Player_Latitude);
+         const float lon = m_ptable->m_settings.LoadFloat(Settings::Player_Longitude);
 
          const double rlat = lat * (M_PI / 180.);
          const double rlong = lon * (M_PI / 180.);
@@ -1267,7 +1304,7 @@ HRESULT Player::Init()
       }
       else
       {
-         m_globalEmissionScale = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "EmissionScale"s, 0.5f);
+         m_globalEmissionScale = m_ptable->m_settings.LoadFloat(Settings::Player_EmissionScale);
       }
    }
    if (g_pvp->m_bgles)
@@ -1319,6 +1356,7 @@ HRESULT Player::Init()
    PLOGI << "Initializing inputs & implicit objects"; // For profiling
 
    m_pininput.Init(GetHwnd());
+   m_pininput.StartInputThread();
 
    //
    const unsigned int lflip = get_vk(m_rgKeys[eLeftFlipperKey]);
@@ -1368,8 +1406,8 @@ HRESULT Player::Init()
 
    m_legacyNudgeTime = 0;
 
-   m_legacyNudge = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "EnableLegacyNudge"s, false);
-   m_legacyNudgeStrength = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "LegacyNudgeStrength"s, 1.f);
+   m_legacyNudge = m_ptable->m_settings.LoadBool(Settings::Player_EnableLegacyNudge);
+   m_legacyNudgeStrength = m_ptable->m_settings.LoadFloat(Settings::Player_LegacyNudgeStrength);
 
    m_legacyNudgeBack = Vertex2D(0.f,0.f);
 
@@ -1453,9 +1491,9 @@ HRESULT Player::Init()
    m_accelVelOld.SetZero();
 
    // Accelerometer inputs are accelerations (not velocities) by default
-   m_accelInputIsVelocity = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "AccelVelocityInput"s, false);
+   m_accelInputIsVelocity = m_ptable->m_settings.LoadBool(Settings::Player_AccelVelocityInput);
 
-   m_plungerSpeedScale = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "PlungerSpeedScale"s, 100.0f) / 100.0f;
+   m_plungerSpeedScale = m_ptable->m_settings.LoadFloat(Settings::Player_PlungerSpeedScale) / 100.0f;
    if (m_plungerSpeedScale <= 0.0f)
       m_plungerSpeedScale = 1.0f;
 
@@ -1491,32 +1529,40 @@ HRESULT Player::Init()
 
    PLOGI << "Initializing Hitables"; // For profiling
 
+   // Hit shapes generation (mesh reduction, ramp/rubber tessellation,...) is independent for each part, so it is done in parallel
+   // into per part lists, which are then appended in the table order to keep the physics reproducible
+   const U64 hitShapesStart = usec();
+   vector<vector<HitObject *>> partHitObjects(m_ptable->m_vedit.size());
+   m_hitMeshCacheEnabled = (m_ptable->m_settings.LoadInt(Settings::Player_CacheMode) > 0) && FileExists(m_ptable->m_szFileName);
+   {
+      ThreadPool pool(g_pvp->m_logicalNumberOfProcessors);
+      for (size_t i = 0; i < m_ptable->m_vedit.size(); i++)
+      {
+         Hitable * const ph = m_ptable->m_vedit[i]->GetIHitable();
+         if (ph)
+            pool.enqueue([ph, &partHitObjects, i] { ph->GetHitShapes(partHitObjects[i]); });
+      }
+      pool.wait_until_nothing_in_flight();
+   }
+   PLOGI << "Hit shapes generated in " << ((usec() - hitShapesStart) / 1000) << "ms"; // For profiling
+
    for (size_t i = 0; i < m_ptable->m_vedit.size(); i++)
    {
       IEditable * const pe = m_ptable->m_vedit[i];
       Hitable * const ph = pe->GetIHitable();
       if (ph)
       {
-#ifdef DEBUGPHYSICS
-         if(pe->GetScriptable())
+         // Save the objects the trouble of having to set the idispatch pointer themselves
+         for (HitObject * const pho : partHitObjects[i])
          {
-            CComBSTR bstr;
-            pe->GetScriptable()->get_Name(&bstr);
-            char * bstr2 = MakeChar(bstr);
-            CHAR wzDst[256];
-            sprintf_s(wzDst, sizeof(wzDst), "Initializing Object-Physics %s...", bstr2);
-            delete [] bstr2;
-            m_pEditorTable->m_progressDialog.SetName(wzDst);
+            pho->m_pfedebug = pe->GetIFireEvents();
+            m_vho.push_back(pho);
          }
-#endif
-         const size_t currentsize = m_vho.size();
-         ph->GetHitShapes(m_vho);
-         const size_t newsize = m_vho.size();
-         // Save the objects the trouble of having to set the idispatch pointer themselves
-         for (size_t hitloop = currentsize; hitloop < newsize; hitloop++)
-            m_vho[hitloop]->m_pfedebug = pe->GetIFireEvents();
 
-         ph->GetTimers(m_vht);
+         vector<HitTimer*> vht;
+         ph->GetTimers(vht);
+         for (HitTimer *const pht : vht)
+            m_timers.Schedule(pht);
 
          // build list of hitables
          m_vhitables.push_back(ph);
@@ -1550,14 +1596,19 @@ HRESULT Player::Init()
 #endif
 
    // initialize hit structure for dynamic objects
-   m_hitoctree_dynamic.FillFromVector(m_vho_dynamic);
+#ifndef USE_EMBREE
+   if (m_ballSpatialHash)
+      m_hitgrid_dynamic.FillFromVector(m_vho_dynamic);
+   else
+#endif
+      m_hitoctree_dynamic.FillFromVector(m_vho_dynamic);
 
    //----------------------------------------------------------------------------------
 
    m_pEditorTable->m_progressDialog.SetProgress(50);
    m_pEditorTable->m_progressDialog.SetName("Loading Textures..."s);
 
-   if ((m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "CacheMode"s, 1) > 0) && FileExists(m_ptable->m_szFileName))
+   if ((m_ptable->m_settings.LoadInt(Settings::Player_CacheMode) > 0) && FileExists(m_ptable->m_szFileName))
    {
       try {
          string dir = g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + m_ptable->m_szTitle + PATH_SEPARATOR_CHAR;
@@ -1594,7 +1645,7 @@ HRESULT Player::Init()
                   // For dynamic modes (VR, head tracking,...) mark all preloaded textures as static only
                   // This will make the cache wrong for the next non static run but it will rebuild, while the opposite would not (all preloads would stay as not prerender only)
                   m_render_mask = (!IsUsingStaticPrepass() || preRenderOnly) ? STATIC_ONLY : DEFAULT;
-                  m_pin3d.m_pd3dPrimaryDevice->m_texMan.LoadTexture(tex->m_pdsBuffer, (SamplerFilter)filter, (SamplerAddressMode)clampU, (SamplerAddressMode)clampV, linearRGB);
+                  m_pin3d.m_pd3dPrimaryDevice->m_texMan.LoadTexture(tex->GetRawBitmap(), (SamplerFilter)filter, (SamplerAddressMode)clampU, (SamplerAddressMode)clampV, linearRGB);
                   PLOGI << "Texture preloading: '" << name << '\'';
                }
             }
@@ -1639,13 +1690,14 @@ HRESULT Player::Init()
       hitable->RenderSetup(m_pin3d.m_pd3dPrimaryDevice);
 
    // Setup anisotropic filtering
-   const bool forceAniso = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ForceAnisotropicFiltering"s, true);
+   const bool forceAniso = m_ptable->m_settings.LoadBool(Settings::Player_ForceAnisotropicFiltering);
    m_pin3d.m_pd3dPrimaryDevice->SetMainTextureDefaultFiltering(forceAniso ? SF_ANISOTROPIC : SF_TRILINEAR);
 
    const bool lowDetailBall = (m_ptable->GetDetailLevel() < 10);
    IndexBuffer *ballIndexBuffer = new IndexBuffer(m_pin3d.m_pd3dPrimaryDevice, lowDetailBall ? basicBallLoNumFaces : basicBallMidNumFaces, lowDetailBall ? basicBallLoIndices : basicBallMidIndices);
    VertexBuffer *ballVertexBuffer = new VertexBuffer(m_pin3d.m_pd3dPrimaryDevice, lowDetailBall ? basicBallLoNumVertices : basicBallMidNumVertices, (float *)(lowDetailBall ? basicBallLo : basicBallMid));
    m_ballMeshBuffer = new MeshBuffer(L"Ball"s, ballVertexBuffer, ballIndexBuffer, true);
+   m_ballLightIndex.Init(m_ptable);
    #ifdef DEBUG_BALL_SPIN
    {
       vector<Vertex3D_NoTex2> ballDbgVtx;
@@ -1673,8 +1725,8 @@ HRESULT Player::Init()
       m_ballDebugPoints = new MeshBuffer(L"Ball.Debug"s, ballDebugPoints);
    }
    #endif
-   // Support up to 64 balls, that should be sufficient
-   VertexBuffer* ballTrailVertexBuffer = new VertexBuffer(m_pin3d.m_pd3dPrimaryDevice, 64 * (MAX_BALL_TRAIL_POS - 2) * 2 + 4, nullptr, true);
+   // Support up to 64 balls, that should be sufficient (each trail strip is joined to the previous one by 2 degenerate vertices)
+   VertexBuffer* ballTrailVertexBuffer = new VertexBuffer(m_pin3d.m_pd3dPrimaryDevice, 64 * (MAX_BALL_TRAIL_POS * 2 + 2), nullptr, true);
    m_ballTrailMeshBuffer = new MeshBuffer(L"Ball.Trail"s, ballTrailVertexBuffer);
 
    #ifdef ENABLE_SDL
@@ -1910,7 +1962,7 @@ void Player::RenderStaticPrepass()
    }
 
    // if rendering static/with heavy oversampling, re-enable the aniso/trilinear filter now for the normal rendering
-   const bool forceAniso = m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ForceAnisotropicFiltering"s, true);
+   const bool forceAniso = m_ptable->m_settings.LoadBool(Settings::Player_ForceAnisotropicFiltering);
    m_pin3d.m_pd3dPrimaryDevice->SetMainTextureDefaultFiltering(forceAniso ? SF_ANISOTROPIC : SF_TRILINEAR);
 
    // Now finalize static buffer with static AO
@@ -2047,7 +2099,12 @@ Ball *Player::CreateBall(const float x, const float y, const float z, const floa
    pball->CalcHitBBox(); // need to update here, as only done lazily
 
    m_vho_dynamic.push_back(pball);
-   m_hitoctree_dynamic.FillFromVector(m_vho_dynamic);
+#ifndef USE_EMBREE
+   if (m_ballSpatialHash)
+      m_hitgrid_dynamic.FillFromVector(m_vho_dynamic);
+   else
+#endif
+      m_hitoctree_dynamic.FillFromVector(m_vho_dynamic);
 
    if (!m_pactiveballDebug)
       m_pactiveballDebug = pball;
@@ -2074,7 +2131,12 @@ void Player::DestroyBall(Ball *pball)
    RemoveFromVectorSingle<MoverObject*>(m_vmover, &pball->m_mover);
    RemoveFromVectorSingle<HitObject*>(m_vho_dynamic, pball);
 
-   m_hitoctree_dynamic.FillFromVector(m_vho_dynamic);
+#ifndef USE_EMBREE
+   if (m_ballSpatialHash)
+      m_hitgrid_dynamic.FillFromVector(m_vho_dynamic);
+   else
+#endif
+      m_hitoctree_dynamic.FillFromVector(m_vho_dynamic);
 
    m_vballDelete.push_back(pball);
 
@@ -2603,7 +2665,12 @@ void Player::PhysicsSimulateCycle(float dtime) // move physics forward to this t
 
    int StaticCnts = STATICCNTS; // maximum number of static counts
    // it's okay to have this code outside of the inner loop, as the ball hitrects already include the maximum distance they can travel in that timespan
-   m_hitoctree_dynamic.Update();
+#ifndef USE_EMBREE
+   if (m_ballSpatialHash)
+      m_hitgrid_dynamic.Update();
+   else
+#endif
+      m_hitoctree_dynamic.Update();
 
    while (dtime > 0.f)
    {
@@ -2665,16 +2732,15 @@ void Player::PhysicsSimulateCycle(float dtime) // move physics forward to this t
             DoHitTest(pball, &m_hitTopGlass, pball->m_coll);
 
 #ifndef USE_EMBREE
-            if (rand_mt_01() < 0.5f) // swap order of dynamic and static obj checks randomly
-            {
-               m_hitoctree_dynamic.HitTestBall(pball, pball->m_coll); // dynamic objects
+            const bool dynamicFirst = rand_mt_01() < 0.5f; // swap order of dynamic and static obj checks randomly
+            if (!dynamicFirst)
                m_hitoctree.HitTestBall(pball, pball->m_coll);         // find the static hit objects hit times
-            }
+            if (m_ballSpatialHash)
+               m_hitgrid_dynamic.HitTestBall(pball, pball->m_coll);   // dynamic objects
             else
-            {
-               m_hitoctree.HitTestBall(pball, pball->m_coll);         // find the static hit objects hit times
                m_hitoctree_dynamic.HitTestBall(pball, pball->m_coll); // dynamic objects
-            }
+            if (dynamicFirst)
+               m_hitoctree.HitTestBall(pball, pball->m_coll);         // find the static hit objects hit times
 #endif
             const float htz = pball->m_coll.m_hittime; // this ball's hit time
             if (htz < 0.f) pball->m_coll.m_obj = nullptr; // no negative time allowed
@@ -2947,8 +3013,9 @@ void Player::UpdatePhysics()
          // If we're 3/4 of the way through the loop, fire a "controller sync" timer (timers with an interval set to -2) event so VPM can react to input.
          if (m_phys_iterations == 750 / ((int)m_fps + 1))
          {
-            for (HitTimer *const pht : m_vht)
-               if (pht->m_interval == -2)
+            const vector<HitTimer*> &frameTimers = m_timers.GetFrameTimers();
+            for (size_t i = 0, n = frameTimers.size(); i < n; ++i) // timers enabled by the script are appended to the list: they will be fired on the next update
+               if (HitTimer *const pht = frameTimers[i]; pht->m_enabled && pht->m_interval == -2)
                {
                   g_frameProfiler.EnterScriptSection(DISPID_TimerEvents_Timer, pht->m_name);
                   pht->m_pfe->FireGroupEvent(DISPID_TimerEvents_Timer);
@@ -2977,28 +3044,13 @@ void Player::UpdatePhysics()
       //const U32 sim_msec = (U32)(m_curPhysicsFrameTime / 1000);
       const U32 cur_time_msec = (U32)(cur_time_usec / 1000);
 
-      m_pininput.ProcessKeys(/*sim_msec,*/ cur_time_msec);
+      m_pininput.ProcessKeys(/*sim_msec,*/ cur_time_msec, m_curPhysicsFrameTime + delta_frame); // only dispatch the input thread events that happened up to this physics step
 
       mixer_update();
       ushock_update(/*sim_msec*/cur_time_msec);
       plumb_update(/*sim_msec*/cur_time_msec, GetNudgeX(), GetNudgeY());
 
 #ifdef ACCURATETIMERS
-      // do the en/disable changes for the timers that piled up
-      for(size_t i = 0; i < m_changed_vht.size(); ++i)
-          if (m_changed_vht[i].m_enabled) // add the timer?
-          {
-              if (FindIndexOf(m_vht, m_changed_vht[i].m_timer) < 0)
-                  m_vht.push_back(m_changed_vht[i].m_timer);
-          }
-          else // delete the timer?
-          {
-              const int idx = FindIndexOf(m_vht, m_changed_vht[i].m_timer);
-              if (idx >= 0)
-                  m_vht.erase(m_vht.begin() + idx);
-          }
-      m_changed_vht.clear();
-
       Ball * const old_pactiveball = m_pactiveball;
       m_pactiveball = nullptr; // No ball is the active ball for timers/key events
 
@@ -3006,24 +3058,31 @@ void Player::UpdatePhysics()
       {
          const unsigned int p_timeCur = (unsigned int)((m_curPhysicsFrameTime - m_StartTime_usec) / 1000); // milliseconds
 
-         for (size_t i = 0; i < m_vht.size(); i++)
+         // Collect the due timers first, so that timers (re)enabled by the script during this loop are only fired on a later update
+         m_dueTimers.clear();
+         m_timers.PopDueTimers(p_timeCur, m_dueTimers);
+         for (HitTimer * const pht : m_dueTimers)
          {
-            HitTimer * const pht = m_vht[i];
-            if (pht->m_interval >= 0 && pht->m_nextfire <= p_timeCur)
+            if (pht->m_interval >= 0 && pht->m_nextfire <= p_timeCur) // timer may have been disabled or rescheduled by a previously fired timer
             {
                g_frameProfiler.EnterScriptSection(DISPID_TimerEvents_Timer, pht->m_name);
                const unsigned int curnextfire = pht->m_nextfire;
                pht->m_pfe->FireGroupEvent(DISPID_TimerEvents_Timer);
-               // Only add interval if the next fire time hasn't changed since the event was run. 
+               // Only add interval if the next fire time hasn't changed since the event was run (otherwise, the timer has already been rescheduled or disabled). 
                // Handles corner case:
                //Timer1.Enabled = False
                //Timer1.Interval = 1000
                //Timer1.Enabled = True
                if (curnextfire == pht->m_nextfire && pht->m_interval > 0)
+               {
                   while (pht->m_nextfire <= p_timeCur)
                      pht->m_nextfire += pht->m_interval;
+                  m_timers.Schedule(pht);
+               }
                g_frameProfiler.ExitScriptSection(pht->m_name);
             }
+            else if (pht->m_enabled && !pht->m_queued && pht->m_interval >= 0)
+               m_timers.Schedule(pht);
          }
       }
 
@@ -3293,6 +3352,7 @@ void Player::RenderDynamics()
       hitable->Render(m_render_mask);
    for (Ball* ball : m_vball)
       ball->m_pballex->Render(m_render_mask);
+   DrawBallTrails();
    m_render_mask = DEFAULT;
    
    m_pin3d.m_pd3dPrimaryDevice->basicShader->SetTextureNull(SHADER_tex_base_transmission); // need to reset the bulb light texture, as its used as render target for bloom again
@@ -3307,6 +3367,146 @@ void Player::RenderDynamics()
    }
 }
 
+// Build the trails of all balls in a single pass and upload them with a single lock. Trails are then drawn with one draw call per run
+// of balls sharing the same trail appearance (usually all of them), the strips being joined by degenerate triangles.
+void Player::DrawBallTrails()
+{
+   if (!m_trailForBalls || m_ballTrailStrength <= 0.f)
+      return;
+
+   // The radius falloff only depends on the segment index, computed once (thread safe function local static initialization)
+   static const std::array<float, MAX_BALL_TRAIL_POS - 1> radiusFalloff = []()
+   {
+      std::array<float, MAX_BALL_TRAIL_POS - 1> falloff;
+      for (int i = 0; i < MAX_BALL_TRAIL_POS - 1; ++i)
+         falloff[i] = 2.0f / powf((float)(i + 2), 0.6f); //!! consts are for magic radius falloff
+      return falloff;
+   }();
+
+   struct TrailRun
+   {
+      const Ball *ball; // First ball of the run, defining the trail appearance
+      unsigned int start, count;
+   };
+   TrailRun runs[64];
+   unsigned int nRuns = 0;
+
+   const unsigned int maxVertices = m_ballTrailMeshBuffer->m_vb->m_count;
+   m_ballTrailVertices.resize(maxVertices);
+   Vertex3D_NoTex2 *const __restrict vertices = m_ballTrailVertices.data();
+   unsigned int nVertices = 0;
+   for (const Ball *const pball : m_vball)
+   {
+      if (!pball->m_visible)
+         continue;
+      if (nVertices + MAX_BALL_TRAIL_POS * 2 + 2 > maxVertices)
+         break;
+
+      // Leave room for the 2 degenerate vertices if this trail can be appended to the current run
+      const bool joinRun = nRuns > 0 && runs[nRuns - 1].ball->m_pinballEnv == pball->m_pinballEnv && runs[nRuns - 1].ball->m_color == pball->m_color;
+      Vertex3D_NoTex2 *const __restrict strip = vertices + nVertices + (joinRun ? 2 : 0);
+      unsigned int nStrip = 0;
+      const int ringPos = pball->m_ringcounter_oldpos / (10000 / PHYSICS_STEPTIME);
+      for (int i2 = 0; i2 < MAX_BALL_TRAIL_POS - 1; ++i2)
+      {
+         int i3 = ringPos - i2;
+         if (i3 < 0)
+            i3 += MAX_BALL_TRAIL_POS;
+         int io = i3 - 1;
+         if (io < 0)
+            io += MAX_BALL_TRAIL_POS;
+         const Vertex3Ds &p3 = pball->m_oldpos[i3];
+         const Vertex3Ds &po = pball->m_oldpos[io];
+         if ((p3.x == FLT_MAX) && (po.x == FLT_MAX))
+            continue; // No position data => discard
+
+         Vertex3Ds vec(po.x - p3.x, po.y - p3.y, po.z - p3.z);
+         const float ls = vec.LengthSquared();
+         if (ls <= 1e-3f)
+            continue; // Too small => discard
+
+         const float length = sqrtf(ls);
+         // (1 - 1/length)^64 evaluated by repeated squaring //!! 64=magic alpha falloff
+         float falloff = 1.f - 1.f / max(length, 1.0f);
+         for (int k = 0; k < 6; ++k)
+            falloff *= falloff;
+         const float bc = m_ballTrailStrength * falloff;
+         const float r = min(pball->m_d.m_radius * 0.9f, pball->m_d.m_radius * radiusFalloff[i2]);
+         if (bc <= 0.f && r <= 1e-3f)
+            continue; // Fully faded out or radius too small => discard
+
+         vec *= 1.0f / length;
+         const Vertex3Ds up(0.f, 0.f, 1.f); // TODO Should be camera axis instead of fixed vertical
+         const Vertex3Ds n = CrossProduct(vec, up) * r;
+
+         const float tu0 = 0.5f + (float)(i2) * (float)(1.0 / (2.0 * (MAX_BALL_TRAIL_POS - 1)));
+         const float tu1 = 0.5f + (float)(i2 + 1) * (float)(1.0 / (2.0 * (MAX_BALL_TRAIL_POS - 1)));
+         if (nStrip == 0)
+         { // First quad: just commit it
+            strip[0] = { p3.x - n.x, p3.y - n.y, p3.z - n.z, bc, 0.f, 0.f, tu0, 0.f }; //!! abuses normal for now for the color/alpha
+            strip[1] = { p3.x + n.x, p3.y + n.y, p3.z + n.z, bc, 0.f, 0.f, tu0, 1.f };
+            nStrip = 2;
+         }
+         else
+         { // Following quads: blend with the previous points
+            strip[nStrip - 2].x = (p3.x - n.x + strip[nStrip - 2].x) * 0.5f;
+            strip[nStrip - 2].y = (p3.y - n.y + strip[nStrip - 2].y) * 0.5f;
+            strip[nStrip - 2].z = (p3.z - n.z + strip[nStrip - 2].z) * 0.5f;
+            strip[nStrip - 1].x = (p3.x + n.x + strip[nStrip - 1].x) * 0.5f;
+            strip[nStrip - 1].y = (p3.y + n.y + strip[nStrip - 1].y) * 0.5f;
+            strip[nStrip - 1].z = (p3.z + n.z + strip[nStrip - 1].z) * 0.5f;
+         }
+         strip[nStrip    ] = { po.x - n.x, po.y - n.y, po.z - n.z, bc, 0.f, 0.f, tu1, 0.f };
+         strip[nStrip + 1] = { po.x + n.x, po.y + n.y, po.z + n.z, bc, 0.f, 0.f, tu1, 1.f };
+         nStrip += 2;
+      }
+      if (nStrip == 0)
+         continue;
+
+      if (joinRun)
+      {
+         vertices[nVertices] = vertices[nVertices - 1];
+         vertices[nVertices + 1] = strip[0];
+         runs[nRuns - 1].count += nStrip + 2;
+         nVertices += nStrip + 2;
+      }
+      else
+      {
+         runs[nRuns++] = { pball, nVertices, nStrip };
+         nVertices += nStrip;
+      }
+   }
+   if (nVertices == 0)
+      return;
+
+   RenderDevice *const rd = m_pin3d.m_pd3dPrimaryDevice;
+   Vertex3D_NoTex2 *bufvb;
+   m_ballTrailMeshBuffer->m_vb->lock(0, nVertices * sizeof(Vertex3D_NoTex2), (void **)&bufvb, VertexBuffer::DISCARDCONTENTS);
+   memcpy(bufvb, vertices, nVertices * sizeof(Vertex3D_NoTex2));
+   m_ballTrailMeshBuffer->m_vb->unlock();
+
+   rd->ResetRenderState();
+   rd->SetRenderState(RenderState::CULLMODE, RenderState::CULL_NONE);
+   rd->SetRenderState(RenderState::ZWRITEENABLE, RenderState::RS_FALSE);
+   rd->SetRenderState(RenderState::ALPHABLENDENABLE, RenderState::RS_TRUE);
+   rd->SetRenderState(RenderState::SRCBLEND, RenderState::SRC_ALPHA);
+   rd->SetRenderState(RenderState::DESTBLEND, RenderState::INVSRC_ALPHA);
+   rd->SetRenderState(RenderState::BLENDOP, RenderState::BLENDOP_ADD);
+   rd->m_ballShader->SetTechnique(SHADER_TECHNIQUE_RenderBallTrail);
+   rd->m_ballShader->SetVector(SHADER_w_h_disableLighting,
+      1.5f / (float)rd->GetPreviousBackBufferTexture()->GetWidth(),
+      1.5f / (float)rd->GetPreviousBackBufferTexture()->GetHeight(),
+      m_disableLightingForBalls ? 1.f : 0.f, 0.f);
+   for (unsigned int i = 0; i < nRuns; ++i)
+   {
+      const Ball *const pball = runs[i].ball;
+      const vec4 diffuse = convertColor(pball->m_color, 1.0f);
+      rd->m_ballShader->SetVector(SHADER_cBase_Alpha, &diffuse);
+      rd->m_ballShader->SetTexture(SHADER_tex_ball_color, pball->m_pinballEnv ? pball->m_pinballEnv : &m_pin3d.m_pinballEnvTexture);
+      rd->DrawMesh(rd->m_ballShader, true, pball->m_d.m_pos, 0.f, m_ballTrailMeshBuffer, RenderDevice::TRIANGLESTRIP, runs[i].start, runs[i].count);
+   }
+}
+
 void Player::SSRefl()
 {
    m_pin3d.m_pd3dPrimaryDevice->SetRenderTarget("ScreenSpace Reflection"s, m_pin3d.m_pd3dPrimaryDevice->GetReflectionBufferTexture(), false);
@@ -3409,7 +3609,7 @@ string Player::GetPerfInfo()
         << "%%\n";
    info << "Draw calls: " << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumDrawCalls() << "  (" << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumLockCalls() << " Locks)\n";
    info << "State changes: " << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumStateChanges() << "\n";
-   info << "Texture changes: " << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumTextureChanges() << " (" << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumTextureUploads() << " Uploads)\n";
+   info << "Texture changes: " << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumTextureChanges() << " (" << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumTextureUploads() << " Uploads, " << (m_pin3d.m_pd3dPrimaryDevice->Perf_GetTextureUploadBytes() + 1023) / 1024 << " KiB)\n";
    info << "Shader/Parameter changes: " << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumTechniqueChanges() << " / " << m_pin3d.m_pd3dPrimaryDevice->Perf_GetNumParameterChanges() << "\n";
    info << "Objects: " << (unsigned int)m_vhitables.size() << "\n";
    info << "\n";
@@ -4149,9 +4349,13 @@ void Player::PrepareFrame()
          }
    }
 
+   // Deliver the coalesced events (mainly Animate events raised by the animation update above) at most once per object
+   m_scriptEventQueue.Flush();
+
    // Fire all '-1' (the ones which are synced to the refresh rate) and '-2' (the ones used to sync with the controller) timers after physics and animation update but before rendering, to avoid the script being one frame late
-   for (HitTimer *const pht : m_vht)
-      if (pht->m_interval < 0)
+   const vector<HitTimer*> &frameTimers = m_timers.GetFrameTimers();
+   for (size_t i = 0, n = frameTimers.size(); i < n; ++i) // timers enabled by the script are appended to the list: they will be fired on the next frame
+      if (HitTimer *const pht = frameTimers[i]; pht->m_enabled && pht->m_interval < 0)
       {
          g_frameProfiler.EnterScriptSection(DISPID_TimerEvents_Timer, pht->m_name);
          pht->m_pfe->FireGroupEvent(DISPID_TimerEvents_Timer);
@@ -4195,15 +4399,7 @@ void Player::PrepareFrame()
    else if (m_liveUI->IsTweakMode())
       m_pin3d.InitLayout();
 
-   // Setup ball rendering: collect all lights that can reflect on balls
-   m_ballTrailMeshBufferPos = 0;
-   m_ballReflectedLights.clear();
-   for (size_t i = 0; i < m_ptable->m_vedit.size(); i++)
-   {
-      IEditable * const item = m_ptable->m_vedit[i];
-      if (item && item->GetItemType() == eItemLight && ((Light *)item)->m_d.m_showReflectionOnBall)
-         m_ballReflectedLights.push_back((Light *)item);
-   }
+   // Setup ball rendering (lights that can reflect on balls are indexed once at startup, see m_ballLightIndex)
    // We don't need to set the dependency on the previous frame render as this would be a cross frame dependency which does not have any meaning since dependencies are resolved per frame
    // m_pin3d.m_pd3dPrimaryDevice->AddRenderTargetDependency(m_pin3d.m_pd3dPrimaryDevice->GetPreviousBackBufferTexture());
    m_pin3d.m_pd3dPrimaryDevice->m_ballShader->SetTexture(SHADER_tex_ball_playfield, m_pin3d.m_pd3dPrimaryDevice->GetPreviousBackBufferTexture()->GetColorSampler());
@@ -4269,41 +4465,33 @@ bool Player::FinishFrame()
    m_fps = (float) (1e6 / g_frameProfiler.GetSlidingAvg(FrameProfiler::PROFILE_FRAME));
 
 #ifndef ACCURATETIMERS
-   // do the en/disable changes for the timers that piled up
-   for (size_t i = 0; i < m_changed_vht.size(); ++i)
-       if (m_changed_vht[i].enabled) // add the timer?
-       {
-           if (FindIndexOf(m_vht, m_changed_vht[i].m_timer) < 0)
-               m_vht.push_back(m_changed_vht[i].m_timer);
-       }
-       else // delete the timer?
-       {
-           const int idx = FindIndexOf(m_vht, m_changed_vht[i].m_timer);
-           if (idx >= 0)
-               m_vht.erase(m_vht.begin() + idx);
-       }
-   m_changed_vht.clear();
-
    Ball * const old_pactiveball = m_pactiveball;
    m_pactiveball = nullptr;  // No ball is the active ball for timers/key events
 
-   for (size_t i=0;i<m_vht.size();i++)
+   // Collect the due timers first, so that timers (re)enabled by the script during this loop are only fired on a later frame
+   m_dueTimers.clear();
+   m_timers.PopDueTimers(m_time_msec, m_dueTimers);
+   for (HitTimer * const pht : m_dueTimers)
    {
-      HitTimer * const pht = m_vht[i];
-      if (pht->m_interval >= 0 && pht->m_nextfire <= m_time_msec) 
+      if (pht->m_interval >= 0 && pht->m_nextfire <= m_time_msec) // timer may have been disabled or rescheduled by a previously fired timer
       {
          g_frameProfiler.EnterScriptSection(DISPID_TimerEvents_Timer, pht->m_name);
          const unsigned int curnextfire = pht->m_nextfire;
          pht->m_pfe->FireGroupEvent(DISPID_TimerEvents_Timer);
-         // Only add interval if the next fire time hasn't changed since the event was run. 
+         // Only add interval if the next fire time hasn't changed since the event was run (otherwise, the timer has already been rescheduled or disabled). 
          // Handles corner case:
          //Timer1.Enabled = False
          //Timer1.Interval = 1000
          //Timer1.Enabled = True
          if (curnextfire == pht->m_nextfire)
+         {
             pht->m_nextfire += pht->m_interval;
+            m_timers.Schedule(pht);
+         }
          g_frameProfiler.ExitScriptSection(pht->m_name);
       }
+      else if (pht->m_enabled && !pht->m_queued && pht->m_interval >= 0)
+         m_timers.Schedule(pht);
    }
 
    m_pactiveball = old_pactiveball;
@@ -4535,7 +4723,12 @@ void Player::DoDebugObjectMenu(const int x, const int y)
    //const float xhit = v3d.x - (v3d.z*slopex);
 
    vector<HitObject*> vhoHit;
-   m_hitoctree_dynamic.HitTestXRay(&ballT, vhoHit, ballT.m_coll);
+#ifndef USE_EMBREE
+   if (m_ballSpatialHash)
+      m_hitgrid_dynamic.HitTestXRay(&ballT, vhoHit, ballT.m_coll);
+   else
+#endif
+      m_hitoctree_dynamic.HitTestXRay(&ballT, vhoHit, ballT.m_coll);
    m_hitoctree.HitTestXRay(&ballT, vhoHit, ballT.m_coll);
    m_debugoctree.HitTestXRay(&ballT, vhoHit, ballT.m_coll);
 
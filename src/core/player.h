@@ -338,12 +338,6 @@ class NudgeFilterY : public NudgeFilter
 
 ////////////////////////////////////////////////////////////////////////////////
 
-struct TimerOnOff
-{
-   HitTimer* m_timer;
-   bool m_enabled;
-};
-
 class Player : public CWnd
 {
 public:
@@ -504,8 +498,12 @@ private:
    HitQuadtree m_hitoctree_dynamic; // should be generated from scratch each time something changes
 #else
    HitKD m_hitoctree_dynamic; // should be generated from scratch each time something changes
+   HitBallGrid m_hitgrid_dynamic; // alternative ball vs ball broad-phase, used instead of m_hitoctree_dynamic if m_ballSpatialHash is set
+   bool m_ballSpatialHash;
 #endif
 
+   bool m_hitMeshCacheEnabled = false; // resolved before the parallel hit shape generation, so that parts do not have to query the settings from worker threads
+
    float m_NudgeShake; // whether to shake the screen during nudges and how much
 
    HitPlane m_hitPlayfield; // HitPlanes cannot be part of octree (infinite size)
@@ -548,6 +546,7 @@ private:
    void RenderStaticPrepass();
    void DrawBulbLightBuffer();
    void RenderDynamics();
+   void DrawBallTrails();
    void PrepareVideoBuffers();
    void Bloom();
    void SSRefl();
@@ -559,13 +558,13 @@ private:
    Vertex2D m_ScreenOffset; // for screen shake effect during nudge
 
 public:
-   vector<Light*> m_ballReflectedLights;
+   BallLightIndex m_ballLightIndex; // Lights that can reflect on balls, with spatial lookup of the nearest ones
    MeshBuffer *m_ballMeshBuffer = nullptr;
    MeshBuffer *m_ballTrailMeshBuffer = nullptr;
    #ifdef DEBUG_BALL_SPIN
    MeshBuffer *m_ballDebugPoints = nullptr;
    #endif
-   int m_ballTrailMeshBufferPos = 0;
+   vector<Vertex3D_NoTex2> m_ballTrailVertices; // Trail geometry of all balls, rebuilt each frame
    bool m_trailForBalls;
    float m_ballTrailStrength;
    bool m_disableLightingForBalls;
@@ -681,8 +680,10 @@ public:
    vector<Ball*> m_vball;
    vector<HitFlipper*> m_vFlippers;
 
-   vector<HitTimer*> m_vht;
-   vector<TimerOnOff> m_changed_vht; // stores all en/disable changes to the m_vht timer list, to avoid problems with timers dis/enabling themselves
+   HitTimerQueue m_timers;          // enabled timers, ordered by next fire time
+   vector<HitTimer*> m_dueTimers;   // timers to be fired during the current timer update
+
+   ScriptEventQueue m_scriptEventQueue; // pending coalesced events of the parts that opted in for event coalescing
 
 #pragma region Input
 public:
@@ -756,6 +757,7 @@ public:
    bool m_capExtDMD;
    int2 m_dmd;
    BaseTexture* m_texdmd;
+   vector<DWORD> m_dmdFrame; // last frame submitted by script
 
    bool m_capPUP;
    BaseTexture *m_texPUP = nullptr;
@@ -37,7 +37,7 @@ void BallEx::RenderSetup(RenderDevice *device)
 {
    assert(m_rd == nullptr);
    m_rd = device;
-   m_antiStretch = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "BallAntiStretch"s, false);
+   m_antiStretch = g_pplayer->m_ptable->m_settings.LoadBool(Settings::Player_BallAntiStretch);
 }
 
 void BallEx::RenderRelease()
@@ -57,30 +57,137 @@ inline float map_bulblight_to_emission(const Light* const l) // magic mapping of
    return l->m_currentIntensity * clamp(powf(l->m_d.m_falloff*0.6f, l->m_d.m_falloff_power*0.6f), 0.f, 23000.f); //!! 0.6f,0.6f = magic, also clamp 23000
 }
 
-void search_for_nearest(const Ball * const pball, const vector<Light*> &lights, Light* light_nearest[MAX_BALL_LIGHT_SOURCES])
+void BallLightIndex::Init(const PinTable * const table)
 {
+   m_lights.clear();
+   for (IEditable * const item : table->m_vedit)
+      if (item && item->GetItemType() == eItemLight)
+         m_lights.push_back((Light *)item);
+   m_dirty = true;
+}
+
+void BallLightIndex::Update()
+{
+   m_dirty = false;
+   m_reflectedLights.clear();
+   for (Light * const light : m_lights)
+      if (light->m_d.m_showReflectionOnBall)
+         m_reflectedLights.push_back(light);
+
+   m_gridW = m_gridH = 0;
+   m_cellStart.clear();
+   m_cellLights.clear();
+   if (m_reflectedLights.empty())
+      return;
+
+   // Grid covers the bounds of the lights (not the table, as backglass lights may lie outside of it), sized for roughly 2 lights per cell
+   float maxX = -FLT_MAX, maxY = -FLT_MAX;
+   m_minX = m_minY = FLT_MAX;
+   for (const Light * const light : m_reflectedLights)
+   {
+      m_minX = min(m_minX, light->m_d.m_vCenter.x);
+      m_minY = min(m_minY, light->m_d.m_vCenter.y);
+      maxX = max(maxX, light->m_d.m_vCenter.x);
+      maxY = max(maxY, light->m_d.m_vCenter.y);
+   }
+   const float sizeX = max(maxX - m_minX, 1.f), sizeY = max(maxY - m_minY, 1.f);
+   const float cellSize = sqrtf(sizeX * sizeY * 2.f / (float)m_reflectedLights.size());
+   m_gridW = clamp((int)ceilf(sizeX / cellSize), 1, 64);
+   m_gridH = clamp((int)ceilf(sizeY / cellSize), 1, 64);
+   m_cellW = sizeX / (float)m_gridW;
+   m_cellH = sizeY / (float)m_gridH;
+   m_invCellW = 1.f / m_cellW;
+   m_invCellH = 1.f / m_cellH;
+
+   vector<unsigned int> lightCell(m_reflectedLights.size());
+   m_cellStart.resize(m_gridW * m_gridH + 1, 0);
+   for (size_t i = 0; i < m_reflectedLights.size(); ++i)
+   {
+      const int cx = clamp((int)((m_reflectedLights[i]->m_d.m_vCenter.x - m_minX) * m_invCellW), 0, m_gridW - 1);
+      const int cy = clamp((int)((m_reflectedLights[i]->m_d.m_vCenter.y - m_minY) * m_invCellH), 0, m_gridH - 1);
+      lightCell[i] = cy * m_gridW + cx;
+      m_cellStart[lightCell[i] + 1]++;
+   }
+   for (size_t i = 1; i < m_cellStart.size(); ++i)
+      m_cellStart[i] += m_cellStart[i - 1];
+   m_cellLights.resize(m_reflectedLights.size());
+   vector<unsigned int> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+   for (size_t i = 0; i < m_reflectedLights.size(); ++i) // keep table order inside each cell
+      m_cellLights[fill[lightCell[i]]++] = m_reflectedLights[i];
+}
+
+void BallLightIndex::FindNearest(const Ball * const pball, Light* light_nearest[MAX_BALL_LIGHT_SOURCES])
+{
+   if (m_dirty)
+      Update();
+
+   float nearest_dist[MAX_BALL_LIGHT_SOURCES];
    for (unsigned int l = 0; l < MAX_BALL_LIGHT_SOURCES; ++l)
    {
-      float min_dist = FLT_MAX;
       light_nearest[l] = nullptr;
-      for (size_t i = 0; i < lights.size(); ++i)
-      {
-         bool already_processed = false;
-         for (unsigned int i2 = 0; i2 < MAX_BALL_LIGHT_SOURCES - 1; ++i2)
-            if (l > i2 && light_nearest[i2] == lights[i]) {
-               already_processed = true;
-               break;
-            }
-         if (already_processed)
-            continue;
+      nearest_dist[l] = FLT_MAX;
+   }
+   if (m_reflectedLights.empty())
+      return;
 
-         const float dist = Vertex3Ds(lights[i]->m_d.m_vCenter.x - pball->m_d.m_pos.x, lights[i]->m_d.m_vCenter.y - pball->m_d.m_pos.y, lights[i]->m_d.m_meshRadius + lights[i]->m_surfaceHeight - pball->m_d.m_pos.z).LengthSquared(); //!! z pos
+   const float bx = pball->m_d.m_pos.x, by = pball->m_d.m_pos.y;
+   const int cx = clamp((int)floorf((bx - m_minX) * m_invCellW), 0, m_gridW - 1);
+   const int cy = clamp((int)floorf((by - m_minY) * m_invCellH), 0, m_gridH - 1);
+   const int maxRing = max(max(cx, m_gridW - 1 - cx), max(cy, m_gridH - 1 - cy));
+   const auto visitCell = [&](const int x, const int y)
+   {
+      if (x < 0 || x >= m_gridW || y < 0 || y >= m_gridH)
+         return;
+      const int cell = y * m_gridW + x;
+      for (unsigned int i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i)
+      {
+         Light * const light = m_cellLights[i];
+         const float dist = Vertex3Ds(light->m_d.m_vCenter.x - bx, light->m_d.m_vCenter.y - by, light->m_d.m_meshRadius + light->m_surfaceHeight - pball->m_d.m_pos.z).LengthSquared(); //!! z pos
          //const float contribution = map_bulblight_to_emission(lights[i]) / dist; // could also weight in light color if necessary //!! JF didn't like that, seems like only distance is a measure better suited for the human eye
-         if (dist < min_dist)
+         if (dist >= nearest_dist[MAX_BALL_LIGHT_SOURCES - 1])
+            continue;
+         int l = MAX_BALL_LIGHT_SOURCES - 1;
+         for (; l > 0 && dist < nearest_dist[l - 1]; --l)
          {
-            min_dist = dist;
-            light_nearest[l] = lights[i];
+            nearest_dist[l] = nearest_dist[l - 1];
+            light_nearest[l] = light_nearest[l - 1];
          }
+         nearest_dist[l] = dist;
+         light_nearest[l] = light;
+      }
+   };
+   for (int r = 0; r <= maxRing; ++r)
+   {
+      // Visit all cells of the ring at distance r around the ball cell
+      const int x0 = cx - r, x1 = cx + r, y0 = cy - r, y1 = cy + r;
+      for (int x = x0; x <= x1; ++x)
+      {
+         visitCell(x, y0);
+         if (r > 0)
+            visitCell(x, y1);
+      }
+      for (int y = y0 + 1; y < y1; ++y)
+      {
+         visitCell(x0, y);
+         visitCell(x1, y);
+      }
+
+      // Stop as soon as no unvisited cell can hold a light nearer than the farthest selected one.
+      // Unvisited cells all lie beyond one of the sides of the visited block that did not reach the grid border yet.
+      if (light_nearest[MAX_BALL_LIGHT_SOURCES - 1] != nullptr)
+      {
+         float bound = FLT_MAX;
+         if (x0 > 0)
+            bound = min(bound, bx - (m_minX + (float)x0 * m_cellW));
+         if (x1 < m_gridW - 1)
+            bound = min(bound, (m_minX + (float)(x1 + 1) * m_cellW) - bx);
+         if (y0 > 0)
+            bound = min(bound, by - (m_minY + (float)y0 * m_cellH));
+         if (y1 < m_gridH - 1)
+            bound = min(bound, (m_minY + (float)(y1 + 1) * m_cellH) - by);
+         bound = max(bound, 0.f);
+         if (bound * bound >= nearest_dist[MAX_BALL_LIGHT_SOURCES - 1])
+            break;
       }
    }
 }
@@ -118,7 +225,7 @@ void BallEx::Render(const unsigned int renderMask)
 
    // collect the x nearest lights that can reflect on balls
    Light* light_nearest[MAX_BALL_LIGHT_SOURCES];
-   search_for_nearest(m_pball, g_pplayer->m_ballReflectedLights, light_nearest);
+   g_pplayer->m_ballLightIndex.FindNearest(m_pball, light_nearest);
    #ifdef ENABLE_SDL
    float lightPos[MAX_LIGHT_SOURCES + MAX_BALL_LIGHT_SOURCES][4] = { 0.0f, 0.0f, 0.0f, 0.0f };
    float lightEmission[MAX_LIGHT_SOURCES + MAX_BALL_LIGHT_SOURCES][4] = { 0.0f, 0.0f, 0.0f, 0.0f };
@@ -305,102 +412,7 @@ void BallEx::Render(const unsigned int renderMask)
    }
    #endif
 
-   // ball trails (except in reflection passes)
-   if (g_pplayer->m_trailForBalls && g_pplayer->m_ballTrailStrength > 0.f && !isReflectionPass)
-   {
-      Vertex3D_NoTex2 vertices[MAX_BALL_TRAIL_POS * 2];
-      unsigned int nVertices = 0;
-      for (int i2 = 0; i2 < MAX_BALL_TRAIL_POS - 1; ++i2)
-      {
-         int i3 = m_pball->m_ringcounter_oldpos / (10000 / PHYSICS_STEPTIME) - i2;
-         if (i3 < 0)
-            i3 += MAX_BALL_TRAIL_POS;
-         int io = i3 - 1;
-         if (io < 0)
-            io += MAX_BALL_TRAIL_POS;
-         if ((m_pball->m_oldpos[i3].x == FLT_MAX) && (m_pball->m_oldpos[io].x == FLT_MAX))
-            continue; // No position data => discard
-
-         Vertex3Ds vec(m_pball->m_oldpos[io].x - m_pball->m_oldpos[i3].x, m_pball->m_oldpos[io].y - m_pball->m_oldpos[i3].y, m_pball->m_oldpos[io].z - m_pball->m_oldpos[i3].z);
-         const float ls = vec.LengthSquared();
-         if (ls <= 1e-3f)
-            continue; // Too small => discard
-
-         const float length = sqrtf(ls);
-         const float bc = g_pplayer->m_ballTrailStrength * powf(1.f - 1.f / max(length, 1.0f), 64.0f); //!! 64=magic alpha falloff
-         const float r = min(m_pball->m_d.m_radius*0.9f, 2.0f*m_pball->m_d.m_radius / powf((float)(i2 + 2), 0.6f)); //!! consts are for magic radius falloff
-         if (bc <= 0.f && r <= 1e-3f)
-            continue; // Fully faded out or radius too small => discard
-
-         vec *= 1.0f / sqrtf(ls);
-         const Vertex3Ds up(0.f, 0.f, 1.f); // TODO Should be camera axis instead of fixed vertical
-         const Vertex3Ds n = CrossProduct(vec, up) * r;
-
-         Vertex3D_NoTex2 quadVertices[4];
-         quadVertices[0].x = m_pball->m_oldpos[i3].x - n.x;
-         quadVertices[0].y = m_pball->m_oldpos[i3].y - n.y;
-         quadVertices[0].z = m_pball->m_oldpos[i3].z - n.z;
-         quadVertices[1].x = m_pball->m_oldpos[i3].x + n.x;
-         quadVertices[1].y = m_pball->m_oldpos[i3].y + n.y;
-         quadVertices[1].z = m_pball->m_oldpos[i3].z + n.z;
-         quadVertices[2].x = m_pball->m_oldpos[io].x + n.x;
-         quadVertices[2].y = m_pball->m_oldpos[io].y + n.y;
-         quadVertices[2].z = m_pball->m_oldpos[io].z + n.z;
-         quadVertices[3].x = m_pball->m_oldpos[io].x - n.x;
-         quadVertices[3].y = m_pball->m_oldpos[io].y - n.y;
-         quadVertices[3].z = m_pball->m_oldpos[io].z - n.z;
-
-         quadVertices[0].nx = quadVertices[1].nx = quadVertices[2].nx = quadVertices[3].nx = bc; //!! abuses normal for now for the color/alpha
-
-         quadVertices[0].tu = 0.5f + (float)(i2) * (float)(1.0 / (2.0 * (MAX_BALL_TRAIL_POS - 1)));
-         quadVertices[0].tv = 0.f;
-         quadVertices[1].tu = quadVertices[0].tu;
-         quadVertices[1].tv = 1.f;
-         quadVertices[2].tu = 0.5f + (float)(i2 + 1) * (float)(1.0 / (2.0 * (MAX_BALL_TRAIL_POS - 1)));
-         quadVertices[2].tv = 1.f;
-         quadVertices[3].tu = quadVertices[2].tu;
-         quadVertices[3].tv = 0.f;
-
-         if (nVertices == 0)
-         { // First quad: just commit it
-            vertices[0] = quadVertices[0];
-            vertices[1] = quadVertices[1];
-            vertices[2] = quadVertices[3];
-            vertices[3] = quadVertices[2];
-            nVertices += 4;
-         }
-         else
-         { // Following quads: blend with the previous points
-            vertices[nVertices - 2].x = (quadVertices[0].x + vertices[nVertices - 2].x) * 0.5f;
-            vertices[nVertices - 2].y = (quadVertices[0].y + vertices[nVertices - 2].y) * 0.5f;
-            vertices[nVertices - 2].z = (quadVertices[0].z + vertices[nVertices - 2].z) * 0.5f;
-            vertices[nVertices - 1].x = (quadVertices[1].x + vertices[nVertices - 1].x) * 0.5f;
-            vertices[nVertices - 1].y = (quadVertices[1].y + vertices[nVertices - 1].y) * 0.5f;
-            vertices[nVertices - 1].z = (quadVertices[1].z + vertices[nVertices - 1].z) * 0.5f;
-            vertices[nVertices    ] =    quadVertices[3];
-            vertices[nVertices + 1] =    quadVertices[2];
-            nVertices += 2;
-         }
-      }
-      if (nVertices > 0 && g_pplayer->m_ballTrailMeshBufferPos + nVertices <= g_pplayer->m_ballTrailMeshBuffer->m_vb->m_count)
-      {
-         Vertex3D_NoTex2 *bufvb;
-         g_pplayer->m_ballTrailMeshBuffer->m_vb->lock(
-            g_pplayer->m_ballTrailMeshBufferPos * sizeof(Vertex3D_NoTex2), nVertices * sizeof(Vertex3D_NoTex2), (void **)&bufvb, VertexBuffer::DISCARDCONTENTS);
-         memcpy(bufvb, vertices, nVertices * sizeof(Vertex3D_NoTex2));
-         g_pplayer->m_ballTrailMeshBuffer->m_vb->unlock();
-         m_rd->ResetRenderState();
-         m_rd->SetRenderState(RenderState::CULLMODE, RenderState::CULL_NONE);
-         m_rd->SetRenderState(RenderState::ZWRITEENABLE, RenderState::RS_FALSE);
-         m_rd->SetRenderState(RenderState::ALPHABLENDENABLE, RenderState::RS_TRUE);
-         m_rd->SetRenderState(RenderState::SRCBLEND, RenderState::SRC_ALPHA);
-         m_rd->SetRenderState(RenderState::DESTBLEND, RenderState::INVSRC_ALPHA);
-         m_rd->SetRenderState(RenderState::BLENDOP, RenderState::BLENDOP_ADD);
-         m_rd->m_ballShader->SetTechnique(SHADER_TECHNIQUE_RenderBallTrail);
-         m_rd->DrawMesh(m_rd->m_ballShader, true, pos, 0.f, g_pplayer->m_ballTrailMeshBuffer, RenderDevice::TRIANGLESTRIP, g_pplayer->m_ballTrailMeshBufferPos, nVertices);
-         g_pplayer->m_ballTrailMeshBufferPos += nVertices;
-      }
-   }
+   // ball trails are drawn for all balls at once, see Player::DrawBallTrails
 }
 
 #pragma endregion
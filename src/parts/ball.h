@@ -4,6 +4,7 @@
 #include "renderer/Renderable.h"
 
 class Ball;
+class Light;
 
 // Helper class used for projecting sphere points, which is then used to compensate for projection stretch if anti-ball-stretch is enabled
 class AntiStretchHelper
@@ -34,6 +35,29 @@ public:
    }
 };
 
+// Spatial index of the lights that reflect on balls. The light list is collected once at play start and the grid
+// is only rebuilt when a light is moved or its 'ShowReflectionOnBall' property changes (see Invalidate).
+class BallLightIndex
+{
+public:
+   void Init(const PinTable * const table);
+   void Invalidate() { m_dirty = true; }
+   void FindNearest(const Ball * const pball, Light* light_nearest[MAX_BALL_LIGHT_SOURCES]);
+
+private:
+   void Update();
+
+   vector<Light*> m_lights;          // all lights of the played table
+   vector<Light*> m_reflectedLights; // lights that can reflect on balls
+   bool m_dirty = true;
+
+   // uniform 2D grid over the reflected lights, stored as a compact array of light lists per cell
+   int m_gridW = 0, m_gridH = 0;
+   float m_minX = 0.f, m_minY = 0.f, m_invCellW = 0.f, m_invCellH = 0.f, m_cellW = 0.f, m_cellH = 0.f;
+   vector<unsigned int> m_cellStart;
+   vector<Light*> m_cellLights;
+};
+
 class BallEx :
    public CComObjectRootEx<CComSingleThreadModel>,
    public CComCoClass<BallEx, &CLSID_Ball>,
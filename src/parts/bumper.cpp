@@ -274,12 +274,10 @@ void Bumper::RenderSetup(RenderDevice *device)
       m_ringTexture.LoadFromFile(g_pvp->m_szMyPath + "assets" + PATH_SEPARATOR_CHAR + "BumperRing.webp");
       m_ringTexture.m_alphaTestValue = (float)(-1.0 / 255.0);
       IndexBuffer* ringIndexBuffer = new IndexBuffer(m_rd, bumperRingNumIndices, bumperRingIndices);
-      VertexBuffer *ringVertexBuffer = new VertexBuffer(m_rd, bumperRingNumVertices, nullptr, true);
-      m_ringVertices = new Vertex3D_NoTex2[bumperRingNumVertices];
-      GenerateRingMesh(m_ringVertices);
+      VertexBuffer *ringVertexBuffer = new VertexBuffer(m_rd, bumperRingNumVertices);
       Vertex3D_NoTex2 *buf;
-      ringVertexBuffer->lock(0, 0, (void**)&buf, VertexBuffer::DISCARDCONTENTS);
-      memcpy(buf, m_ringVertices, bumperRingNumVertices*sizeof(Vertex3D_NoTex2));
+      ringVertexBuffer->lock(0, 0, (void**)&buf, VertexBuffer::WRITEONLY);
+      GenerateRingMesh(buf);
       ringVertexBuffer->unlock();
       delete m_ringMeshBuffer;
       m_ringMeshBuffer = new MeshBuffer(m_wzName + L".Ring"s, ringVertexBuffer, ringIndexBuffer, true);
@@ -313,9 +311,6 @@ void Bumper::RenderRelease()
    m_socketMeshBuffer = nullptr;
    m_baseTexture.FreeStuff();
    m_ringTexture.FreeStuff();
-
-   delete[] m_ringVertices;
-   m_ringVertices = nullptr;
    m_capTexture.FreeStuff();
    m_skirtTexture.FreeStuff();
 
@@ -376,8 +371,14 @@ void Bumper::Render(const unsigned int renderMask)
       }
       m_rd->ResetRenderState();
       m_rd->basicShader->SetBasic(&ringMaterial, &m_ringTexture);
-      Vertex3Ds pos(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight + m_pbumperhitcircle->m_bumperanim_ringAnimOffset);
+      // The ring mesh is static, its animation is applied through the world matrix
+      const float ringOffset = m_pbumperhitcircle->m_bumperanim_ringAnimOffset;
+      if (ringOffset != 0.f)
+         g_pplayer->UpdateBasicShaderMatrix(Matrix3D::MatrixTranslate(0.f, 0.f, ringOffset));
+      Vertex3Ds pos(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight + ringOffset);
       m_rd->DrawMesh(m_rd->basicShader, false, pos, 0.f, m_ringMeshBuffer, RenderDevice::TRIANGLELIST, 0, bumperRingNumIndices);
+      if (ringOffset != 0.f)
+         g_pplayer->UpdateBasicShaderMatrix();
    }
 
    if (m_d.m_skirtVisible && !isStaticOnly)
@@ -432,22 +433,8 @@ void Bumper::UpdateSkirt(const bool doCalculation)
 
    Vertex3D_NoTex2 *buf;
    m_socketMeshBuffer->m_vb->lock(0, 0, (void**)&buf, VertexBuffer::DISCARDCONTENTS);
-   for (unsigned int i = 0; i < bumperSocketNumVertices; i++)
-   {
-      Vertex3Ds vert(bumperSocket[i].x, bumperSocket[i].y, bumperSocket[i].z);
-      vert = rMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*scalexy + m_d.m_vCenter.x;
-      buf[i].y = vert.y*scalexy + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_heightScale + (m_baseHeight+5.0f);
-
-      vert = Vertex3Ds(bumperSocket[i].nx, bumperSocket[i].ny, bumperSocket[i].nz);
-      vert = rMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = bumperSocket[i].tu;
-      buf[i].tv = bumperSocket[i].tv;
-   }
+   const Matrix3D vertMatrix = rMatrix * Matrix3D::MatrixScale(scalexy, scalexy, m_d.m_heightScale) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight + 5.0f);
+   vertMatrix.TransformVertices(bumperSocket, buf, bumperSocketNumVertices, rMatrix);
    m_socketMeshBuffer->m_vb->unlock();
 }
 
@@ -526,88 +513,29 @@ void Bumper::ExportMesh(ObjLoader& loader)
 void Bumper::GenerateBaseMesh(Vertex3D_NoTex2 *buf)
 {
    const float scalexy = m_d.m_radius;
-   for (unsigned int i = 0; i < bumperBaseNumVertices; i++)
-   {
-      Vertex3Ds vert(bumperBase[i].x, bumperBase[i].y, bumperBase[i].z);
-      vert = m_fullMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*scalexy + m_d.m_vCenter.x;
-      buf[i].y = vert.y*scalexy + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_heightScale + m_baseHeight;
-
-      vert = Vertex3Ds(bumperBase[i].nx, bumperBase[i].ny, bumperBase[i].nz);
-      vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = bumperBase[i].tu;
-      buf[i].tv = bumperBase[i].tv;
-   }
+   const Matrix3D vertMatrix = m_fullMatrix * Matrix3D::MatrixScale(scalexy, scalexy, m_d.m_heightScale) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight);
+   vertMatrix.TransformVertices(bumperBase, buf, bumperBaseNumVertices, m_fullMatrix);
 }
 
 void Bumper::GenerateSocketMesh(Vertex3D_NoTex2 *buf)
 {
    const float scalexy = m_d.m_radius;
-
-   for (unsigned int i = 0; i < bumperSocketNumVertices; i++)
-   {
-      Vertex3Ds vert(bumperSocket[i].x, bumperSocket[i].y, bumperSocket[i].z);
-      vert = m_fullMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*scalexy + m_d.m_vCenter.x;
-      buf[i].y = vert.y*scalexy + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_heightScale + (m_baseHeight+5.0f);
-
-      vert = Vertex3Ds(bumperSocket[i].nx, bumperSocket[i].ny, bumperSocket[i].nz);
-      vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = bumperSocket[i].tu;
-      buf[i].tv = bumperSocket[i].tv;
-   }
+   const Matrix3D vertMatrix = m_fullMatrix * Matrix3D::MatrixScale(scalexy, scalexy, m_d.m_heightScale) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight + 5.0f);
+   vertMatrix.TransformVertices(bumperSocket, buf, bumperSocketNumVertices, m_fullMatrix);
 }
 
 void Bumper::GenerateRingMesh(Vertex3D_NoTex2 *buf)
 {
    const float scalexy = m_d.m_radius;
-
-   for (unsigned int i = 0; i < bumperRingNumVertices; i++)
-   {
-      Vertex3Ds vert(bumperRing[i].x, bumperRing[i].y, bumperRing[i].z);
-      vert = m_fullMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*scalexy + m_d.m_vCenter.x;
-      buf[i].y = vert.y*scalexy + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_heightScale + m_baseHeight;
-
-      vert = Vertex3Ds(bumperRing[i].nx, bumperRing[i].ny, bumperRing[i].nz);
-      vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = bumperRing[i].tu;
-      buf[i].tv = bumperRing[i].tv;
-   }
+   const Matrix3D vertMatrix = m_fullMatrix * Matrix3D::MatrixScale(scalexy, scalexy, m_d.m_heightScale) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight);
+   vertMatrix.TransformVertices(bumperRing, buf, bumperRingNumVertices, m_fullMatrix);
 }
 
 void Bumper::GenerateCapMesh(Vertex3D_NoTex2 *buf)
 {
    const float scalexy = m_d.m_radius*2.0f;
-
-   for (unsigned int i = 0; i < bumperCapNumVertices; i++)
-   {
-      Vertex3Ds vert(bumperCap[i].x, bumperCap[i].y, bumperCap[i].z);
-      vert = m_fullMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*scalexy + m_d.m_vCenter.x;
-      buf[i].y = vert.y*scalexy + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_heightScale + (m_d.m_heightScale + m_baseHeight);
-
-      vert = Vertex3Ds(bumperCap[i].nx, bumperCap[i].ny, bumperCap[i].nz);
-      vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = bumperCap[i].tu;
-      buf[i].tv = bumperCap[i].tv;
-   }
+   const Matrix3D vertMatrix = m_fullMatrix * Matrix3D::MatrixScale(scalexy, scalexy, m_d.m_heightScale) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_d.m_heightScale + m_baseHeight);
+   vertMatrix.TransformVertices(bumperCap, buf, bumperCapNumVertices, m_fullMatrix);
 }
 
 //
@@ -637,7 +565,6 @@ void Bumper::UpdateAnimation(const float diff_time_msec)
          float step = m_d.m_ringSpeed;
          if (m_ringDown)
               step = -step;
-         const float old_bumperanim_ringAnimOffset = m_pbumperhitcircle->m_bumperanim_ringAnimOffset;
          m_pbumperhitcircle->m_bumperanim_ringAnimOffset += step * diff_time_msec;
          if (m_ringDown)
          {
@@ -655,25 +582,6 @@ void Bumper::UpdateAnimation(const float diff_time_msec)
                   m_ringAnimate = false;
               }
          }
-         if (m_ringMeshBuffer && (old_bumperanim_ringAnimOffset != m_pbumperhitcircle->m_bumperanim_ringAnimOffset))
-         {
-            //TODO update Worldmatrix instead.
-            Vertex3D_NoTex2 *buf;
-            m_ringMeshBuffer->m_vb->lock(0, 0, (void **)&buf, VertexBuffer::DISCARDCONTENTS);
-            for (unsigned int i = 0; i < bumperRingNumVertices; i++)
-            {
-               buf[i].x = m_ringVertices[i].x;
-               buf[i].y = m_ringVertices[i].y;
-               buf[i].z = m_ringVertices[i].z + m_pbumperhitcircle->m_bumperanim_ringAnimOffset;
-               buf[i].nx = m_ringVertices[i].nx;
-               buf[i].ny = m_ringVertices[i].ny;
-               buf[i].nz = m_ringVertices[i].nz;
-               buf[i].tu = m_ringVertices[i].tu;
-               buf[i].tv = m_ringVertices[i].tv;
-            }
-            m_ringMeshBuffer->m_vb->unlock();
-         }
-
          FireGroupEvent(DISPID_AnimateEvents_Animate);
       }
    }
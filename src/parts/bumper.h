@@ -114,7 +114,6 @@ private:
    MeshBuffer *m_capMeshBuffer = nullptr;
 
    Matrix3D m_fullMatrix;
-   Vertex3D_NoTex2 *m_ringVertices = nullptr;
    Texture m_ringTexture;
    Texture m_skirtTexture;
    Texture m_baseTexture;
@@ -225,6 +225,23 @@ void DispReel::RenderSetup(RenderDevice *device)
       m_reelInfo[i].motorOffset = 0;
    }
 
+   m_reelSound = (m_d.m_szSound != "<None>") ? m_ptable->GetSound(m_d.m_szSound) : nullptr;
+
+   vector<WORD> indices(MAX_REELS * 6);
+   for (unsigned int i = 0; i < MAX_REELS; i++)
+   {
+      indices[i * 6 + 0] = i * 4 + 0;
+      indices[i * 6 + 1] = i * 4 + 1;
+      indices[i * 6 + 2] = i * 4 + 2;
+      indices[i * 6 + 3] = i * 4 + 2;
+      indices[i * 6 + 4] = i * 4 + 1;
+      indices[i * 6 + 5] = i * 4 + 3;
+   }
+   VertexBuffer *vb = new VertexBuffer(m_rd, MAX_REELS * 4, nullptr, true);
+   IndexBuffer *ib = new IndexBuffer(m_rd, indices);
+   m_reelMeshBuffer = new MeshBuffer(m_wzName + L".Reels"s, vb, ib, true);
+   m_reelQuadCount = 0;
+
    // get a pointer to the image specified in the object
    Texture * const pin = m_ptable->GetImage(m_d.m_szImage); // pointer to image information from the image manager
 
@@ -299,6 +316,9 @@ void DispReel::RenderSetup(RenderDevice *device)
 void DispReel::RenderRelease()
 {
    assert(m_rd != nullptr);
+   delete m_reelMeshBuffer;
+   m_reelMeshBuffer = nullptr;
+   m_reelSound = nullptr;
    m_rd = nullptr;
 }
 
@@ -331,14 +351,8 @@ void DispReel::UpdateAnimation(const float diff_time_msec)
             m_reelInfo[i].motorOffset = 0;
 
             // play the sound (if any) for each click of the reel
-            if (!m_d.m_szSound.empty() && (m_d.m_szSound != "<None>"))
-            {
-               WCHAR mySound[MAXTOKEN];
-               MultiByteToWideCharNull(CP_ACP, 0, m_d.m_szSound.c_str(), -1, mySound, MAXTOKEN);
-               const BSTR mySoundBSTR = SysAllocString(mySound);
-               m_ptable->PlaySound(mySoundBSTR, 0, 1.0f, 0.f, 0.f, 0, VARIANT_FALSE, VARIANT_TRUE, 0.f);
-               SysFreeString(mySoundBSTR);
-            }
+            if (m_reelSound)
+               m_ptable->PlaySound(m_reelSound, 0, 1.0f, 0.f, 0.f, 0, false, true, 0.f);
 
             animated = true;
          }
@@ -432,33 +446,37 @@ void DispReel::Render(const unsigned int renderMask)
          float x1 = m_d.m_v1.x / (float)EDITOR_BG_WIDTH  + renderspacingx;
    const float y1 = m_d.m_v1.y / (float)EDITOR_BG_HEIGHT + renderspacingy;
 
-   for (int r = 0; r < m_d.m_reelcount; ++r) //!! optimize by doing all draws in a single one
+   Vertex3D_NoTex2 vertices[MAX_REELS * 4];
+   for (int r = 0; r < m_d.m_reelcount; ++r)
    {
-      const float u0 = m_digitTexCoords[m_reelInfo[r].currentValue].u_min;
-      const float v0 = m_digitTexCoords[m_reelInfo[r].currentValue].v_min;
-      const float u1 = m_digitTexCoords[m_reelInfo[r].currentValue].u_max;
-      const float v1 = m_digitTexCoords[m_reelInfo[r].currentValue].v_max;
-
-      Vertex3D_NoTex2 vertices[4] =
-      {
-         { 1.f, 1.f, 0.f, 0.f, 0.f, 1.f, u1, v1 },
-         { 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, u0, v1 },
-         { 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, u1, v0 },
-         { 0.f, 0.f, 0.f, 0.f, 0.f, 1.f, u0, v0 }
-      };
-
-      for (unsigned int i = 0; i < 4; ++i)
-      {
-         vertices[i].x =        (vertices[i].x * m_renderwidth  + x1)*2.0f - 1.0f;
-         vertices[i].y = 1.0f - (vertices[i].y * m_renderheight + y1)*2.0f;
-      }
-
-      m_rd->DrawTexturedQuad(m_rd->DMDShader, vertices);
+      const TexCoordRect &tc = m_digitTexCoords[m_reelInfo[r].currentValue];
+      const float x0 =         x1                  *2.0f - 1.0f;
+      const float x2 =        (x1 + m_renderwidth) *2.0f - 1.0f;
+      const float y0 = 1.0f -  y1                  *2.0f;
+      const float y2 = 1.0f - (y1 + m_renderheight)*2.0f;
+      Vertex3D_NoTex2 *const v = vertices + r * 4;
+      v[0] = { x2, y2, 0.f, 0.f, 0.f, 1.f, tc.u_max, tc.v_max };
+      v[1] = { x0, y2, 0.f, 0.f, 0.f, 1.f, tc.u_min, tc.v_max };
+      v[2] = { x2, y0, 0.f, 0.f, 0.f, 1.f, tc.u_max, tc.v_min };
+      v[3] = { x0, y0, 0.f, 0.f, 0.f, 1.f, tc.u_min, tc.v_min };
 
       // move to the next reel
       x1 += renderspacingx + m_renderwidth;
    }
 
+   // Only upload the reel quads when a reel has turned (or the reels have been moved/resized)
+   if (m_reelQuadCount != m_d.m_reelcount || memcmp(vertices, m_reelVertices, m_d.m_reelcount * 4 * sizeof(Vertex3D_NoTex2)) != 0)
+   {
+      m_reelQuadCount = m_d.m_reelcount;
+      memcpy(m_reelVertices, vertices, m_reelQuadCount * 4 * sizeof(Vertex3D_NoTex2));
+      Vertex3D_NoTex2 *buf;
+      m_reelMeshBuffer->m_vb->lock(0, m_reelQuadCount * 4 * sizeof(Vertex3D_NoTex2), (void **)&buf, VertexBuffer::DISCARDCONTENTS);
+      memcpy(buf, m_reelVertices, m_reelQuadCount * 4 * sizeof(Vertex3D_NoTex2));
+      m_reelMeshBuffer->m_vb->unlock();
+   }
+
+   m_rd->DrawMesh(m_rd->DMDShader, false, Vertex3Ds(0.f, 0.f, 0.f), 0.f, m_reelMeshBuffer, RenderDevice::TRIANGLELIST, 0, m_reelQuadCount * 6);
+
    m_rd->DMDShader->SetFloat(SHADER_alphaTestValue, 1.0f);
 }
 
@@ -764,6 +782,8 @@ STDMETHODIMP DispReel::put_Sound(BSTR newVal)
    char buf[MAXTOKEN];
    WideCharToMultiByteNull(CP_ACP, 0, newVal, -1, buf, MAXTOKEN, nullptr, nullptr);
    m_d.m_szSound = buf;
+   if (m_rd)
+      m_reelSound = (m_d.m_szSound != "<None>") ? m_ptable->GetSound(m_d.m_szSound) : nullptr;
 
    return S_OK;
 }
@@ -179,6 +179,12 @@ private:
    };
    vector<TexCoordRect> m_digitTexCoords;
 
+   PinSound   *m_reelSound = nullptr;          // sound played for each turn of a digit, resolved once at play start
+
+   MeshBuffer *m_reelMeshBuffer = nullptr;     // one quad per reel, all drawn in a single call
+   Vertex3D_NoTex2 m_reelVertices[MAX_REELS * 4]; // last uploaded content of m_reelMeshBuffer
+   int         m_reelQuadCount = 0;
+
    // IDispReel
 public:
    // properties
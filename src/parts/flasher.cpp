@@ -827,95 +827,22 @@ STDMETHODIMP Flasher::put_DMDHeight(int pVal)
    return S_OK;
 }
 
-// Implementation included in pintable.cpp
-void upscale(DWORD *const data, const int2 &res, const bool is_brightness_data);
-
-STDMETHODIMP Flasher::put_DMDPixels(VARIANT pVal) // assumes VT_UI1 as input //!! use 64bit instead of 8bit to reduce overhead??
+STDMETHODIMP Flasher::put_DMDPixels(VARIANT pVal) // accepts an array of VARIANTs or a packed array of brightness values
 {
-   SAFEARRAY *psa = V_ARRAY(&pVal);
    if (m_rd == nullptr)
       return E_FAIL;
 
-   if (psa && m_dmdSize.x > 0 && m_dmdSize.y > 0)
-   {
-      const int size = m_dmdSize.x * m_dmdSize.y;
-      if (!m_texdmd
-#ifdef DMD_UPSCALE
-         || (m_texdmd->width() * m_texdmd->height() != size * (3 * 3)))
-#else
-         || (m_texdmd->width() * m_texdmd->height() != size))
-#endif
-      {
-         if (m_texdmd)
-         {
-            m_rd->DMDShader->SetTextureNull(SHADER_tex_dmd);
-            m_rd->m_texMan.UnloadTexture(m_texdmd);
-            delete m_texdmd;
-         }
-#ifdef DMD_UPSCALE
-         m_texdmd = new BaseTexture(m_dmdSize.x * 3, m_dmdSize.y * 3, BaseTexture::RGBA);
-#else
-         m_texdmd = new BaseTexture(m_dmdSize.x, m_dmdSize.y, BaseTexture::RGBA);
-#endif
-      }
-
-      DWORD *const data = (DWORD *)m_texdmd->data(); //!! assumes tex data to be always 32bit
-
-      VARIANT *p;
-      SafeArrayAccessData(psa, (void **)&p);
-      for (int ofs = 0; ofs < size; ++ofs)
-         data[ofs] = V_UI4(&p[ofs]); // store raw values (0..100), let shader do the rest
-      SafeArrayUnaccessData(psa);
-
-      if (g_pplayer->m_scaleFX_DMD)
-         upscale(data, m_dmdSize, true);
-
-      m_rd->m_texMan.SetDirty(m_texdmd);
-   }
+   UpdateDMDTexture(m_rd, m_texdmd, m_dmdFrame, m_dmdSize, pVal, false);
 
    return S_OK;
 }
 
-STDMETHODIMP Flasher::put_DMDColoredPixels(VARIANT pVal) //!! assumes VT_UI4 as input //!! use 64bit instead of 32bit to reduce overhead??
+STDMETHODIMP Flasher::put_DMDColoredPixels(VARIANT pVal) // accepts an array of VARIANTs or a packed array of RGB values
 {
-   SAFEARRAY *psa = V_ARRAY(&pVal);
-
-   if (psa && m_dmdSize.x > 0 && m_dmdSize.y > 0)
-   {
-      const int size = m_dmdSize.x * m_dmdSize.y;
-      if (!m_texdmd
-#ifdef DMD_UPSCALE
-         || (m_texdmd->width() * m_texdmd->height() != size * (3 * 3)))
-#else
-         || (m_texdmd->width() * m_texdmd->height() != size))
-#endif
-      {
-         if (m_texdmd)
-         {
-            m_rd->DMDShader->SetTextureNull(SHADER_tex_dmd);
-            m_rd->m_texMan.UnloadTexture(m_texdmd);
-            delete m_texdmd;
-         }
-#ifdef DMD_UPSCALE
-         m_texdmd = new BaseTexture(m_dmdSize.x * 3, m_dmdSize.y * 3, BaseTexture::RGBA);
-#else
-         m_texdmd = new BaseTexture(m_dmdSize.x, m_dmdSize.y, BaseTexture::RGBA);
-#endif
-      }
-
-      DWORD *const data = (DWORD *)m_texdmd->data(); //!! assumes tex data to be always 32bit
-
-      VARIANT *p;
-      SafeArrayAccessData(psa, (void **)&p);
-      for (int ofs = 0; ofs < size; ++ofs)
-         data[ofs] = V_UI4(&p[ofs]) | 0xFF000000u; // store RGB values and let shader do the rest (set alpha to let shader know that this is RGB and not just brightness)
-      SafeArrayUnaccessData(psa);
-
-      if (g_pplayer->m_scaleFX_DMD)
-         upscale(data, m_dmdSize, false);
+   if (m_rd == nullptr)
+      return E_FAIL;
 
-      m_rd->m_texMan.SetDirty(m_texdmd);
-   }
+   UpdateDMDTexture(m_rd, m_texdmd, m_dmdFrame, m_dmdSize, pVal, true);
 
    return S_OK;
 }
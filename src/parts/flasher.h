@@ -161,6 +161,7 @@ private:
 
    int2 m_dmdSize = int2(128,32);
    BaseTexture *m_texdmd = nullptr;
+   vector<DWORD> m_dmdFrame; // last frame submitted by script
 
    Light *m_lightmap = nullptr;
 
@@ -392,9 +392,11 @@ void Gate::RenderSetup(RenderDevice *device)
    m_bracketMeshBuffer = new MeshBuffer(m_wzName + L".Bracket"s, bracketVertexBuffer, bracketIndexBuffer, true);
 
    IndexBuffer *wireIndexBuffer = new IndexBuffer(m_rd, m_numIndices, m_indices);
-   VertexBuffer *wireVertexBuffer = new VertexBuffer(m_rd, m_numVertices, nullptr, true);
-   wireVertexBuffer->lock(0, 0, (void**)&buf, VertexBuffer::DISCARDCONTENTS);
-   GenerateWireMesh(buf);
+   VertexBuffer *wireVertexBuffer = new VertexBuffer(m_rd, m_numVertices);
+   // The wire mesh is static, in its local space (see GetWireTransform), its rotation is applied through the world matrix
+   wireVertexBuffer->lock(0, 0, (void**)&buf, VertexBuffer::WRITEONLY);
+   memcpy(buf, m_vertices, m_numVertices * sizeof(Vertex3D_NoTex2));
+   Matrix3D::MatrixScale(m_d.m_length).TransformPositions(m_vertices, buf, m_numVertices);
    wireVertexBuffer->unlock();
    m_wireMeshBuffer = new MeshBuffer(m_wzName + L".Wire"s, wireVertexBuffer, wireIndexBuffer, true);
 }
@@ -406,7 +408,6 @@ void Gate::RenderRelease()
    m_wireMeshBuffer = nullptr;
    delete m_bracketMeshBuffer;
    m_bracketMeshBuffer = nullptr;
-   m_vertexbuffer_angle = FLT_MAX;
    m_rd = nullptr;
 }
 
@@ -435,34 +436,22 @@ void Gate::Render(const unsigned int renderMask)
    || (isReflectionPass && !m_d.m_reflectionEnabled))
       return;
 
-   if (m_phitgate->m_gateMover.m_angle != m_vertexbuffer_angle)
-   {
-      m_vertexbuffer_angle = m_phitgate->m_gateMover.m_angle;
-
-      Matrix3D fullMatrix, tempMat;
-      fullMatrix.SetRotateX(m_d.m_twoWay ? m_phitgate->m_gateMover.m_angle : -m_phitgate->m_gateMover.m_angle);
-      tempMat.SetRotateZ(ANGTORAD(m_d.m_rotation));
-      tempMat.Multiply(fullMatrix, fullMatrix);
-
-      Matrix3D vertMatrix;
-      tempMat.SetScaling(m_d.m_length, m_d.m_length, m_d.m_length);
-      tempMat.Multiply(fullMatrix, vertMatrix);
-      tempMat.SetTranslation(m_d.m_vCenter.x, m_d.m_vCenter.y, m_d.m_height + m_baseHeight);
-      tempMat.Multiply(vertMatrix, vertMatrix);
-
-      Vertex3D_NoTex2 *buf;
-      m_wireMeshBuffer->m_vb->lock(0, 0, (void **)&buf, VertexBuffer::DISCARDCONTENTS);
-      vertMatrix.TransformPositions(m_vertices, buf, m_numVertices);
-      fullMatrix.TransformNormals(m_vertices, buf, m_numVertices);
-      m_wireMeshBuffer->m_vb->unlock();
-   }
-
    m_rd->ResetRenderState();
    m_rd->basicShader->SetBasic(m_ptable->GetMaterial(m_d.m_szMaterial), nullptr);
    Vertex3Ds pos(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight);
    if (m_d.m_showBracket)
       m_rd->DrawMesh(m_rd->basicShader, false, pos, 0.f, m_bracketMeshBuffer, RenderDevice::TRIANGLELIST, 0, gateBracketNumIndices);
+   g_pplayer->UpdateBasicShaderMatrix(GetWireTransform());
    m_rd->DrawMesh(m_rd->basicShader, false, pos, 0.f, m_wireMeshBuffer, RenderDevice::TRIANGLELIST, 0, m_numIndices);
+   g_pplayer->UpdateBasicShaderMatrix();
+}
+
+// Transform of the wire from its local space (scaled by the gate length) to world space
+Matrix3D Gate::GetWireTransform() const
+{
+   Matrix3D rotX;
+   rotX.SetRotateX(m_d.m_twoWay ? m_phitgate->m_gateMover.m_angle : -m_phitgate->m_gateMover.m_angle);
+   return rotX * Matrix3D::MatrixRotateZ(ANGTORAD(m_d.m_rotation)) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_d.m_height + m_baseHeight);
 }
 
 #pragma endregion
@@ -102,6 +102,7 @@ public:
 private:
    void GenerateBracketMesh(Vertex3D_NoTex2 *buf);
    void GenerateWireMesh(Vertex3D_NoTex2 *buf);
+   Matrix3D GetWireTransform() const;
 
    PinTable *m_ptable = nullptr;
    
@@ -111,7 +112,6 @@ private:
    HitGate *m_phitgate = nullptr;
    float m_lastAngle;
 
-   float m_vertexbuffer_angle = FLT_MAX;
    MeshBuffer *m_wireMeshBuffer = nullptr;
    MeshBuffer *m_bracketMeshBuffer = nullptr;
 
@@ -434,26 +434,8 @@ void HitTarget::GenerateMesh(vector<Vertex3D_NoTex2> &buf)
    tempMatrix.SetRotateZ(ANGTORAD(m_d.m_rotZ));
    tempMatrix.Multiply(fullMatrix, fullMatrix);
 
-   for (unsigned int i = 0; i < m_numVertices; i++)
-   {
-      Vertex3Ds vert(m_vertices[i].x, m_vertices[i].y, m_vertices[i].z);
-      vert.x *= m_d.m_vSize.x;
-      vert.y *= m_d.m_vSize.y;
-      vert.z *= m_d.m_vSize.z;
-      vert = fullMatrix.MultiplyVector(vert);
-
-      buf[i].x = vert.x + m_d.m_vPosition.x;
-      buf[i].y = vert.y + m_d.m_vPosition.y;
-      buf[i].z = vert.z + m_d.m_vPosition.z;
-
-      vert = Vertex3Ds(m_vertices[i].nx, m_vertices[i].ny, m_vertices[i].nz);
-      vert = fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = m_vertices[i].tu;
-      buf[i].tv = m_vertices[i].tv;
-   }
+   const Matrix3D vertMatrix = Matrix3D::MatrixScale(m_d.m_vSize.x, m_d.m_vSize.y, m_d.m_vSize.z) * fullMatrix * Matrix3D::MatrixTranslate(m_d.m_vPosition.x, m_d.m_vPosition.y, m_d.m_vPosition.z);
+   vertMatrix.TransformVertices(m_vertices, buf.data(), m_numVertices, fullMatrix);
 }
 
 // recalculate vertices for editor display or hit shapes
@@ -589,7 +571,7 @@ void HitTarget::RenderSetup(RenderDevice *device)
 
    GenerateMesh(m_transformedVertices);
    delete m_meshBuffer;
-   VertexBuffer *vertexBuffer = new VertexBuffer(m_rd, (unsigned int)m_numVertices, (float *)m_transformedVertices.data(), true);
+   VertexBuffer *vertexBuffer = new VertexBuffer(m_rd, (unsigned int)m_numVertices, (float *)m_transformedVertices.data());
    IndexBuffer *indexBuffer = new IndexBuffer(m_rd, m_numIndices, m_indices);
    m_meshBuffer = new MeshBuffer(m_wzName, vertexBuffer, indexBuffer, true);
 
@@ -600,7 +582,6 @@ void HitTarget::RenderSetup(RenderDevice *device)
        {
            m_moveDown = false;
            m_moveAnimationOffset = -DROP_TARGET_LIMIT;
-           UpdateTarget();
            return;
        }
    }
@@ -673,7 +654,6 @@ void HitTarget::UpdateAnimation(const float diff_time_msec)
                         FireGroupEvent(DISPID_TargetEvents_Raised);
                 }
             }
-            UpdateTarget();
             FireGroupEvent(DISPID_AnimateEvents_Animate);
         }
     }
@@ -702,7 +682,6 @@ void HitTarget::UpdateAnimation(const float diff_time_msec)
                     m_moveAnimation = false;
                 }
             }
-            UpdateTarget();
             FireGroupEvent(DISPID_AnimateEvents_Animate);
         }
     }
@@ -726,6 +705,10 @@ void HitTarget::Render(const unsigned int renderMask)
       return;
 
    m_rd->ResetRenderState();
+   // The mesh is static, in its rest position, the drop/hit animation is applied through the world matrix
+   const bool isAnimated = m_moveAnimationOffset != 0.f;
+   if (isAnimated)
+      g_pplayer->UpdateBasicShaderMatrix(GetAnimationTransform());
    m_rd->basicShader->SetVector(SHADER_fDisableLighting_top_below, m_d.m_disableLightingTop, m_d.m_disableLightingBelow, 0.f, 0.f);
    const Material * const mat = m_ptable->GetMaterial(m_d.m_szMaterial);
    m_rd->basicShader->SetBasic(mat, m_ptable->GetImage(m_d.m_szImage));
@@ -746,59 +729,23 @@ void HitTarget::Render(const unsigned int renderMask)
    m_rd->DrawMesh(m_rd->basicShader, mat->m_bOpacityActive, m_d.m_vPosition, m_d.m_depthBias, m_meshBuffer, RenderDevice::TRIANGLELIST, 0, m_numIndices);
    #endif
    m_rd->basicShader->SetVector(SHADER_fDisableLighting_top_below, 0.f, 0.f, 0.f, 0.f);
+   if (isAnimated)
+      g_pplayer->UpdateBasicShaderMatrix();
 }
 
-void HitTarget::UpdateTarget()
+// Transform from the rest position of the mesh to its animated position
+Matrix3D HitTarget::GetAnimationTransform() const
 {
-   Vertex3D_NoTex2 *buf;
-   m_meshBuffer->m_vb->lock(0, 0, (void**)&buf, VertexBuffer::DISCARDCONTENTS);
    if (m_d.m_targetType == DropTargetBeveled || m_d.m_targetType == DropTargetSimple || m_d.m_targetType == DropTargetFlatSimple)
-   {
-       //TODO Update object Matrix instead
-       for (unsigned int i = 0; i < m_numVertices; i++)
-       {
-           buf[i].x = m_transformedVertices[i].x;
-           buf[i].y = m_transformedVertices[i].y;
-           buf[i].z = m_transformedVertices[i].z + m_moveAnimationOffset;
-           buf[i].nx = m_transformedVertices[i].nx;
-           buf[i].ny = m_transformedVertices[i].ny;
-           buf[i].nz = m_transformedVertices[i].nz;
-           buf[i].tu = m_transformedVertices[i].tu;
-           buf[i].tv = m_transformedVertices[i].tv;
-       }
-   }
-   else
-   {
-       Matrix3D fullMatrix, tempMatrix;
-       fullMatrix.SetRotateX(ANGTORAD(m_moveAnimationOffset));
-       tempMatrix.SetRotateZ(ANGTORAD(m_d.m_rotZ));
-       tempMatrix.Multiply(fullMatrix, fullMatrix);
-
-       Matrix3D vertMatrix;
-       vertMatrix.SetScaling(m_d.m_vSize.x, m_d.m_vSize.y, m_d.m_vSize.z);
-       fullMatrix.Multiply(vertMatrix, vertMatrix);
-       tempMatrix.SetTranslation(m_d.m_vPosition.x, m_d.m_vPosition.y, m_d.m_vPosition.z);
-       tempMatrix.Multiply(vertMatrix, vertMatrix);
-
-       //TODO Update object Matrix instead
-       for (unsigned int i = 0; i < m_numVertices; i++)
-       {
-           Vertex3Ds vert(m_vertices[i].x, m_vertices[i].y, m_vertices[i].z);
-           vert = vertMatrix.MultiplyVector(vert);           
-           buf[i].x = vert.x;
-           buf[i].y = vert.y;
-           buf[i].z = vert.z;
-
-           vert = Vertex3Ds(m_vertices[i].nx, m_vertices[i].ny, m_vertices[i].nz);
-           vert = fullMatrix.MultiplyVectorNoTranslate(vert);
-           buf[i].nx = vert.x;
-           buf[i].ny = vert.y;
-           buf[i].nz = vert.z;
-           buf[i].tu = m_vertices[i].tu;
-           buf[i].tv = m_vertices[i].tv;
-       }
-   }
-   m_meshBuffer->m_vb->unlock();
+      return Matrix3D::MatrixTranslate(0.f, 0.f, m_moveAnimationOffset);
+
+   // Hit targets rotate around their local X axis (before their Z rotation and translation to the target position)
+   Matrix3D rotX, rotZ, invRotZ;
+   rotX.SetRotateX(ANGTORAD(m_moveAnimationOffset));
+   rotZ.SetRotateZ(ANGTORAD(m_d.m_rotZ));
+   invRotZ.SetRotateZ(ANGTORAD(-m_d.m_rotZ));
+   return Matrix3D::MatrixTranslate(-m_d.m_vPosition.x, -m_d.m_vPosition.y, -m_d.m_vPosition.z) * invRotZ * rotX * rotZ
+        * Matrix3D::MatrixTranslate(m_d.m_vPosition.x, m_d.m_vPosition.y, m_d.m_vPosition.z);
 }
 
 #pragma endregion
@@ -180,7 +180,7 @@ public:
 
 private:
 
-   void UpdateTarget();
+   Matrix3D GetAnimationTransform() const;
    void SetupHitObject(vector<HitObject*> &pvho, HitObject * obj, const bool setHitObject);
    void AddHitEdge(vector<HitObject*> &pvho, robin_hood::unordered_set< robin_hood::pair<unsigned, unsigned> >& addedEdges, const unsigned i, const unsigned j, const Vertex3Ds &vi, const Vertex3Ds &vj, const bool setHitObject = true);
 
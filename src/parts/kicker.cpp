@@ -508,25 +508,9 @@ void Kicker::GenerateMesh(Vertex3D_NoTex2 *const buf)
        break;
    }
 
-   Matrix3D fullMatrix;
-   fullMatrix.SetRotateZ(ANGTORAD(zrot));
-
-   for (int i = 0; i < num_vertices; i++)
-   {
-      Vertex3Ds vert(vertices[i].x, vertices[i].y, vertices[i].z + zoffset);
-      vert = fullMatrix.MultiplyVector(vert);
-
-      buf[i].x = vert.x*m_d.m_radius + m_d.m_vCenter.x;
-      buf[i].y = vert.y*m_d.m_radius + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_radius + m_baseHeight;
-      vert = Vertex3Ds(vertices[i].nx, vertices[i].ny, vertices[i].nz);
-      vert = fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-      buf[i].tu = vertices[i].tu;
-      buf[i].tv = vertices[i].tv;
-   }
+   const Matrix3D fullMatrix = Matrix3D::MatrixRotateZ(ANGTORAD(zrot));
+   const Matrix3D vertMatrix = Matrix3D::MatrixTranslate(0.f, 0.f, zoffset) * fullMatrix * Matrix3D::MatrixScale(m_d.m_radius) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_baseHeight);
+   vertMatrix.TransformVertices(vertices, buf, num_vertices, fullMatrix);
 }
 
 void Kicker::SetDefaultPhysics(const bool fromMouseClick)
@@ -1037,7 +1021,7 @@ STDMETHODIMP Kicker::BallCntOver(int *pVal)
       {
          Ball * const pball = g_pplayer->m_vball[i];
 
-         if (pball->m_d.m_vpVolObjs && FindIndexOf(*(pball->m_d.m_vpVolObjs), (IFireEvents*)this) >= 0) // cast to IFireEvents necessary, as it is stored like this in HitObject.m_obj
+         if (pball->m_d.m_vpVolObjs && pball->m_d.m_vpVolObjs->Contains((IFireEvents*)this)) // cast to IFireEvents necessary, as it is stored like this in HitObject.m_obj
          {
             ++cnt;
             g_pplayer->m_pactiveball = pball; // set active ball for scriptor
@@ -1171,14 +1155,14 @@ void KickerHitCircle::DoCollide(Ball * const pball, const Vertex3Ds& hitnormal,
 {
    if (m_pball) return;                              // a previous ball already in kicker
 
-   const int i = FindIndexOf(*(pball->m_d.m_vpVolObjs), m_obj); // check if kicker in ball's volume set
+   const bool inside = pball->m_d.m_vpVolObjs->Contains(m_obj); // check if kicker in ball's volume set
 
-   if (newBall || ((!hitbit) == (i < 0)))            // New or (Hit && !Vol || UnHit && Vol)
+   if (newBall || ((!hitbit) == !inside))            // New or (Hit && !Vol || UnHit && Vol)
    {
       if (m_pkicker->m_d.m_legacyMode || newBall)
          pball->m_d.m_pos += STATICTIME * pball->m_d.m_vel;  // move ball slightly forward
 
-      if (i < 0) // entering Kickers volume
+      if (!inside) // entering Kickers volume
       {
          const float grabHeight = (m_hitBBox.zlow + pball->m_d.m_radius) * m_pkicker->m_d.m_hitAccuracy;
          // early out here if the ball is slow and we are near the kicker center
@@ -1205,7 +1189,7 @@ void KickerHitCircle::DoCollide(Ball * const pball, const Vertex3Ds& hitnormal,
             pball->m_d.m_lockedInKicker = !m_pkicker->m_d.m_fallThrough;
             if (pball->m_d.m_lockedInKicker)
             {
-               pball->m_d.m_vpVolObjs->push_back(m_obj);		// add kicker to ball's volume set
+               pball->m_d.m_vpVolObjs->Add(m_obj);		// add kicker to ball's volume set
                m_pball = pball;
                m_lastCapturedBall = pball;
                if (pball == g_pplayer->m_pactiveballBC)
@@ -1242,7 +1226,7 @@ void KickerHitCircle::DoCollide(Ball * const pball, const Vertex3Ds& hitnormal,
       }
       else // exiting kickers volume
       {
-         pball->m_d.m_vpVolObjs->erase(pball->m_d.m_vpVolObjs->begin() + i); // remove kicker to ball's volume set
+         pball->m_d.m_vpVolObjs->Remove(m_obj); // remove kicker to ball's volume set
          m_pkicker->FireGroupEvent(DISPID_HitEvents_Unhit);
       }
    }
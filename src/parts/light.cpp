@@ -1249,6 +1249,8 @@ STDMETHODIMP Light::get_X(float *pVal)
 STDMETHODIMP Light::put_X(float newVal)
 {
    m_d.m_vCenter.x = newVal;
+   if (g_pplayer)
+      g_pplayer->m_ballLightIndex.Invalidate();
 
    return S_OK;
 }
@@ -1263,6 +1265,8 @@ STDMETHODIMP Light::get_Y(float *pVal)
 STDMETHODIMP Light::put_Y(float newVal)
 {
    m_d.m_vCenter.y = newVal;
+   if (g_pplayer)
+      g_pplayer->m_ballLightIndex.Invalidate();
 
    return S_OK;
 }
@@ -1545,6 +1549,8 @@ STDMETHODIMP Light::get_ShowReflectionOnBall(VARIANT_BOOL *pVal)
 STDMETHODIMP Light::put_ShowReflectionOnBall(VARIANT_BOOL newVal)
 {
    m_d.m_showReflectionOnBall = VBTOb(newVal);
+   if (g_pplayer)
+      g_pplayer->m_ballLightIndex.Invalidate();
 
    return S_OK;
 }
@@ -588,6 +588,31 @@ STDMETHODIMP ScriptGlobalTable::put_ShowCursor(VARIANT_BOOL enable)
    return S_OK;
 }
 
+STDMETHODIMP ScriptGlobalTable::SetEventCoalescing(IDispatch *pObject, VARIANT_BOOL enable)
+{
+   if (!pObject || !g_pplayer)
+      return E_POINTER;
+
+   // Compare COM identities since the script may hand us another interface pointer than the one returned by GetDispatch
+   CComPtr<IUnknown> pUnk;
+   pObject->QueryInterface(IID_IUnknown, (void **)&pUnk);
+   for (IEditable *const pie : m_pt->m_vedit)
+   {
+      IFireEvents *const pfe = pie->GetIFireEvents();
+      if (pfe == nullptr)
+         continue;
+      CComPtr<IUnknown> pItemUnk;
+      pie->GetISelect()->GetDispatch()->QueryInterface(IID_IUnknown, (void **)&pItemUnk);
+      if (pItemUnk == pUnk)
+      {
+         pfe->m_coalesceEvents = VBTOb(enable);
+         return S_OK;
+      }
+   }
+
+   return E_INVALIDARG;
+}
+
 #ifdef _WIN64
 STDMETHODIMP ScriptGlobalTable::get_GetPlayerHWnd(SIZE_T *pVal)
 #else
@@ -947,7 +972,7 @@ STDMETHODIMP ScriptGlobalTable::LoadTexture(BSTR imageName, BSTR fileName)
    if (g_pplayer->m_pEditorTable->GetImage(szImageName))
       return E_FAIL;
    Texture *image = m_pt->ImportImage(szFileName, szImageName);
-   return image->m_pdsBuffer == nullptr ? E_FAIL : S_OK;
+   return image->GetRawBitmapIfDecoded() == nullptr ? E_FAIL : S_OK;
 }
 
 STDMETHODIMP ScriptGlobalTable::get_WindowWidth(int *pVal)
@@ -978,98 +1003,124 @@ STDMETHODIMP ScriptGlobalTable::put_DMDHeight(int pVal)
    return S_OK;
 }
 
-STDMETHODIMP ScriptGlobalTable::put_DMDPixels(VARIANT pVal) // assumes VT_UI1 as input //!! use 64bit instead of 8bit to reduce overhead??
+// Update a DMD texture from a frame submitted by script. The frame can either be a legacy array of VARIANTs, or a packed array of bytes, words or
+// 32 bit values (brightness from 0 to 100 or RGB colors), which avoids the per pixel VARIANT conversion. The last frame is kept to skip the texture
+// upload when the same frame is submitted again (VPinMAME driven tables push frames at a fixed rate, whether they changed or not), and to only
+// upload the rows that changed otherwise.
+void UpdateDMDTexture(RenderDevice* const rd, BaseTexture*& tex, vector<DWORD>& lastFrame, const int2& dmdSize, const VARIANT& pVal, const bool isColored)
 {
-   if (HasDMDCapture()) // If DMD capture is enabled check if external DMD exists
-      return S_OK;
+   SAFEARRAY* const psa = V_ARRAY(&pVal);
+   if (psa == nullptr || rd == nullptr || dmdSize.x <= 0 || dmdSize.y <= 0)
+      return;
 
-   SAFEARRAY *psa = V_ARRAY(&pVal);
+   const size_t size = (size_t)dmdSize.x * dmdSize.y;
+   size_t nElements = 1;
+   for (USHORT i = 0; i < psa->cDims; i++)
+      nElements *= psa->rgsabound[i].cElements;
+   if (psa->cDims == 0 || nElements < size)
+      return;
 
-   if (psa && g_pplayer && g_pplayer->m_dmd.x > 0 && g_pplayer->m_dmd.y > 0)
-   {
-      const int size = g_pplayer->m_dmd.x*g_pplayer->m_dmd.y;
-      if (!g_pplayer->m_texdmd
+   bool changed = lastFrame.size() != size;
+   if (!tex
 #ifdef DMD_UPSCALE
-          || (g_pplayer->m_texdmd->width()*g_pplayer->m_texdmd->height() != size*(3*3)))
+      || ((size_t)tex->width() * tex->height() != size * (3 * 3)))
 #else
-          || (g_pplayer->m_texdmd->width()*g_pplayer->m_texdmd->height() != size))
+      || ((size_t)tex->width() * tex->height() != size))
 #endif
+   {
+      if (tex)
       {
-         if (g_pplayer->m_texdmd)
-         {
-            g_pplayer->m_pin3d.m_pd3dPrimaryDevice->DMDShader->SetTextureNull(SHADER_tex_dmd);
-            g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.UnloadTexture(g_pplayer->m_texdmd);
-            delete g_pplayer->m_texdmd;
-         }
+         rd->DMDShader->SetTextureNull(SHADER_tex_dmd);
+         rd->m_texMan.UnloadTexture(tex);
+         delete tex;
+      }
 #ifdef DMD_UPSCALE
-         g_pplayer->m_texdmd = new BaseTexture(g_pplayer->m_dmd.x*3, g_pplayer->m_dmd.y*3, BaseTexture::RGBA);
+      tex = new BaseTexture(dmdSize.x * 3, dmdSize.y * 3, BaseTexture::RGBA);
 #else
-         g_pplayer->m_texdmd = new BaseTexture(g_pplayer->m_dmd.x, g_pplayer->m_dmd.y, BaseTexture::RGBA);
+      tex = new BaseTexture(dmdSize.x, dmdSize.y, BaseTexture::RGBA);
 #endif
+      changed = true;
+   }
+   lastFrame.resize(size);
+   const bool fullUpdate = changed;
+
+   // Store raw values (0..100) for brightness frames, or RGB values with alpha set to let the shader know that this is RGB and not just brightness
+   const DWORD alpha = isColored ? 0xFF000000u : 0u;
+   DWORD* const __restrict frame = lastFrame.data();
+   VARTYPE vt;
+   if (FAILED(SafeArrayGetVartype(psa, &vt)))
+      vt = VT_VARIANT;
+   void* p;
+   SafeArrayAccessData(psa, &p);
+   int firstRow = dmdSize.y, lastRow = -1;
+   const auto convert = [&](const auto* const __restrict src, const auto getValue)
+   {
+      size_t ofs = 0;
+      for (int y = 0; y < dmdSize.y; ++y)
+      {
+         DWORD diff = 0;
+         for (const size_t rowEnd = ofs + dmdSize.x; ofs < rowEnd; ++ofs)
+         {
+            const DWORD v = getValue(src[ofs]) | alpha;
+            diff |= frame[ofs] ^ v;
+            frame[ofs] = v;
+         }
+         if (diff != 0)
+         {
+            firstRow = min(firstRow, y);
+            lastRow = y;
+         }
       }
+      changed |= lastRow >= 0;
+   };
+   switch (vt)
+   {
+   case VT_UI1: case VT_I1: convert((const BYTE*)p, [](const BYTE v) { return (DWORD)v; }); break;
+   case VT_UI2: case VT_I2: convert((const WORD*)p, [](const WORD v) { return (DWORD)v; }); break;
+   case VT_UI4: case VT_I4: case VT_UINT: case VT_INT: convert((const DWORD*)p, [](const DWORD v) { return v; }); break;
+   default: convert((const VARIANT*)p, [](const VARIANT& v) { return (DWORD)V_UI4(&v); }); break;
+   }
+   SafeArrayUnaccessData(psa);
 
-      DWORD* const data = (DWORD*)g_pplayer->m_texdmd->data(); //!! assumes tex data to be always 32bit
-
-      VARIANT *p;
-      SafeArrayAccessData(psa,(void**)&p);
-      for (int ofs = 0; ofs < size; ++ofs)
-         data[ofs] = V_UI4(&p[ofs]); // store raw values (0..100), let shader do the rest
-      SafeArrayUnaccessData(psa);
-
-      if (g_pplayer->m_scaleFX_DMD)
-         upscale(data, g_pplayer->m_dmd, true);
+   if (!changed)
+      return;
 
-      g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.SetDirty(g_pplayer->m_texdmd);
+   DWORD* const data = (DWORD*)tex->data(); //!! assumes tex data to be always 32bit
+#ifndef DMD_UPSCALE
+   if (!fullUpdate && !g_pplayer->m_scaleFX_DMD)
+   {
+      // Only the changed rows need to be copied and uploaded
+      memcpy(data + (size_t)firstRow * dmdSize.x, frame + (size_t)firstRow * dmdSize.x, (size_t)(lastRow + 1 - firstRow) * dmdSize.x * sizeof(DWORD));
+      rd->m_texMan.SetDirty(tex, RECT { 0, firstRow, dmdSize.x, lastRow + 1 });
+      return;
    }
-
-   return S_OK;
+#endif
+   memcpy(data, frame, size * sizeof(DWORD));
+   if (g_pplayer->m_scaleFX_DMD)
+      upscale(data, dmdSize, !isColored);
+   rd->m_texMan.SetDirty(tex);
 }
 
-STDMETHODIMP ScriptGlobalTable::put_DMDColoredPixels(VARIANT pVal) //!! assumes VT_UI4 as input //!! use 64bit instead of 32bit to reduce overhead??
+STDMETHODIMP ScriptGlobalTable::put_DMDPixels(VARIANT pVal) // accepts an array of VARIANTs or a packed array of brightness values
 {
    if (HasDMDCapture()) // If DMD capture is enabled check if external DMD exists
       return S_OK;
 
-	SAFEARRAY *psa = V_ARRAY(&pVal);
-
-	if (psa && g_pplayer && g_pplayer->m_dmd.x > 0 && g_pplayer->m_dmd.y > 0)
-	{
-		const int size = g_pplayer->m_dmd.x*g_pplayer->m_dmd.y;
-		if (!g_pplayer->m_texdmd
-#ifdef DMD_UPSCALE
-            || (g_pplayer->m_texdmd->width()*g_pplayer->m_texdmd->height() != size*(3*3)))
-#else
-            || (g_pplayer->m_texdmd->width()*g_pplayer->m_texdmd->height() != size))
-#endif
-      {
-         if (g_pplayer->m_texdmd)
-         {
-            g_pplayer->m_pin3d.m_pd3dPrimaryDevice->DMDShader->SetTextureNull(SHADER_tex_dmd);
-            g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.UnloadTexture(g_pplayer->m_texdmd);
-            delete g_pplayer->m_texdmd;
-         }
-#ifdef DMD_UPSCALE
-         g_pplayer->m_texdmd = new BaseTexture(g_pplayer->m_dmd.x*3, g_pplayer->m_dmd.y*3, BaseTexture::RGBA);
-#else
-         g_pplayer->m_texdmd = new BaseTexture(g_pplayer->m_dmd.x, g_pplayer->m_dmd.y, BaseTexture::RGBA);
-#endif
-      }
-
-		DWORD* const data = (DWORD*)g_pplayer->m_texdmd->data(); //!! assumes tex data to be always 32bit
+   if (g_pplayer)
+      UpdateDMDTexture(g_pplayer->m_pin3d.m_pd3dPrimaryDevice, g_pplayer->m_texdmd, g_pplayer->m_dmdFrame, g_pplayer->m_dmd, pVal, false);
 
-		VARIANT *p;
-		SafeArrayAccessData(psa, (void **)&p);
-		for (int ofs = 0; ofs < size; ++ofs)
-			data[ofs] = V_UI4(&p[ofs]) | 0xFF000000u; // store RGB values and let shader do the rest (set alpha to let shader know that this is RGB and not just brightness)
-		SafeArrayUnaccessData(psa);
+   return S_OK;
+}
 
-		if (g_pplayer->m_scaleFX_DMD)
-			upscale(data, g_pplayer->m_dmd, false);
+STDMETHODIMP ScriptGlobalTable::put_DMDColoredPixels(VARIANT pVal) // accepts an array of VARIANTs or a packed array of RGB values
+{
+   if (HasDMDCapture()) // If DMD capture is enabled check if external DMD exists
+      return S_OK;
 
-		g_pplayer->m_pin3d.m_pd3dPrimaryDevice->m_texMan.SetDirty(g_pplayer->m_texdmd);
-	}
+   if (g_pplayer)
+      UpdateDMDTexture(g_pplayer->m_pin3d.m_pd3dPrimaryDevice, g_pplayer->m_texdmd, g_pplayer->m_dmdFrame, g_pplayer->m_dmd, pVal, true);
 
-	return S_OK;
+   return S_OK;
 }
 
 STDMETHODIMP ScriptGlobalTable::get_DisableStaticPrerendering(VARIANT_BOOL *pVal)
@@ -1385,7 +1436,7 @@ PinTable::PinTable()
 
    m_global3DZPD = m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DZPD"s, 0.5f);
    m_3DZPD = 0.5f;
-   m_global3DMaxSeparation = m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DMaxSeparation"s, 0.03f);
+   m_global3DMaxSeparation = m_settings.LoadFloat(Settings::Player_Stereo3DMaxSeparation);
    m_3DmaxSeparation = 0.03f;
    m_global3DOffset = m_settings.LoadValueWithDefault(Settings::Player, "Stereo3DOffset"s, 0.f);
    m_3DOffset = 0.0f;
@@ -2431,7 +2482,7 @@ void PinTable::AutoSave()
    FastIStorage * const pstgroot = new FastIStorage();
    pstgroot->AddRef();
 
-   const HRESULT hr = SaveToStorage(pstgroot);
+   const HRESULT hr = SaveToStorage(pstgroot, true);
 
    m_undo.SetCleanPoint((SaveDirtyState)min((int)m_sdsDirtyProp, (int)eSaveAutosaved));
    m_pcv->SetClean((SaveDirtyState)min((int)m_sdsDirtyScript, (int)eSaveAutosaved));
@@ -2457,6 +2508,16 @@ void PinTable::AutoSave()
    m_vpinball->SetCursorCur(nullptr, IDC_ARROW);
 }
 
+void PinTable::InvalidateAutoSaveData()
+{
+   for (IEditable *const pie : m_vedit)
+      pie->m_autoSaveData.reset();
+   for (PinSound *const pps : m_vsound)
+      pps->m_autoSaveData.reset();
+   for (Texture *const ppi : m_vimage)
+      ppi->m_autoSaveData.reset();
+}
+
 HRESULT PinTable::Save(const bool saveAs)
 {
    IStorage* pstgRoot;
@@ -2587,7 +2648,7 @@ HRESULT PinTable::Save(const bool saveAs)
    return S_OK;
 }
 
-HRESULT PinTable::SaveToStorage(IStorage *pstgRoot)
+HRESULT PinTable::SaveToStorage(IStorage *pstgRoot, const bool autoSave)
 {
    m_savingActive = true;
    RECT rc;
@@ -2677,57 +2738,111 @@ HRESULT PinTable::SaveToStorage(IStorage *pstgRoot)
 
          if (SUCCEEDED(hr = SaveData(pstmGame, hch, false)))
          {
-            for (size_t i = 0; i < m_vedit.size(); i++)
+            // Game items, sounds and images are not part of the table hash, so they are encoded (and compressed) in parallel
+            // into memory streams, which are then written sequentially, in order, to the storage as soon as they are ready.
+            // Decals and textboxes are encoded on this thread, as they save their font through its (apartment threaded) OLE object.
+            // For autosaves, the encoded data is kept on each object, and reused (shared, not copied) by the next autosaves until
+            // the object gets modified (see InvalidateAutoSaveData), so only modified objects are encoded again.
+            const U64 encodeStart = usec();
+            ThreadPool pool(g_pvp->m_logicalNumberOfProcessors);
+            const auto encodeStream = [](const std::function<void(IStream *)> &save)
+            {
+               FastIStream *const pstm = new FastIStream();
+               pstm->AddRef();
+               save(pstm);
+               return pstm;
+            };
+            // Encoding failures are collected with the encoded streams and reported from this thread once all items are stored
+            struct EncodedItem
+            {
+               FastIStream *pstm;
+               HRESULT hr;
+            };
+            vector<IEditable *> failedItems;
+            const auto encodeItem = [](IStream *pstm, IEditable *const piedit) -> HRESULT
+            {
+               ULONG writ;
+               const ItemTypeEnum type = piedit->GetItemType();
+               pstm->Write(&type, sizeof(int), &writ);
+               return piedit->SaveData(pstm, NULL, false);
+            };
+            // Store the encoded stream (or the autosave data of the object if not encoded again), and release the encoded stream
+            const auto storeStream = [&](const string &szStmName, FastIStream *const pstmEncoded, FastIStreamData &autoSaveData)
             {
-               const string szStmName = "GameItem" + std::to_string(i);
                MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
-
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
+               if (autoSave)
+               {
+                  if (pstmEncoded)
+                     autoSaveData = std::make_shared<const vector<char>>(pstmEncoded->m_rg, pstmEncoded->m_rg + pstmEncoded->m_cSize);
+                  ((FastIStorage *)pstgData)->AddSharedStream(wszStmName, autoSaveData);
+               }
+               else if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
                {
                   ULONG writ;
-                  IEditable *const piedit = m_vedit[i];
-                  const ItemTypeEnum type = piedit->GetItemType();
-                  pstmItem->Write(&type, sizeof(int), &writ);
-                  hr = piedit->SaveData(pstmItem, NULL, false);
+                  hr = pstmItem->Write(pstmEncoded->m_rg, pstmEncoded->m_cSize, &writ);
                   pstmItem->Release();
                   pstmItem = nullptr;
-                  //if (FAILED(hr)) goto Error;
                }
+               if (pstmEncoded)
+                  pstmEncoded->Release();
 
                csaveditems++;
                ::SendMessage(hwndProgressBar, PBM_SETPOS, csaveditems, 0);
-            }
+            };
 
-            for (size_t i = 0; i < m_vsound.size(); i++)
+            vector<std::future<EncodedItem>> encodedItems(m_vedit.size());
+            for (size_t i = 0; i < m_vedit.size(); i++)
             {
-               const string szStmName = "Sound" + std::to_string(i);
-               MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
-
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
-               {
-                  SaveSoundToStream(m_vsound[i], pstmItem);
-                  pstmItem->Release();
-                  pstmItem = nullptr;
-               }
+               IEditable *const piedit = m_vedit[i];
+               const ItemTypeEnum type = piedit->GetItemType();
+               if ((!autoSave || !piedit->m_autoSaveData) && type != eItemDecal && type != eItemTextbox)
+                  encodedItems[i] = pool.enqueue([encodeStream, encodeItem, piedit] {
+                     EncodedItem encoded { nullptr, S_OK };
+                     encoded.pstm = encodeStream([&encoded, encodeItem, piedit](IStream *pstm) { encoded.hr = encodeItem(pstm, piedit); });
+                     return encoded;
+                  });
+            }
+            vector<std::future<FastIStream *>> encodedSounds(m_vsound.size());
+            for (size_t i = 0; i < m_vsound.size(); i++)
+               if (!autoSave || !m_vsound[i]->m_autoSaveData)
+                  encodedSounds[i] = pool.enqueue([encodeStream, this, i] { return encodeStream([this, i](IStream *pstm) { SaveSoundToStream(m_vsound[i], pstm); }); });
+            vector<std::future<FastIStream *>> encodedImages(m_vimage.size());
+            for (size_t i = 0; i < m_vimage.size(); i++)
+               if (!autoSave || !m_vimage[i]->m_autoSaveData)
+                  encodedImages[i] = pool.enqueue([encodeStream, this, i] { return encodeStream([this, i](IStream *pstm) { m_vimage[i]->SaveToStream(pstm, this); }); });
 
-               csaveditems++;
-               ::SendMessage(hwndProgressBar, PBM_SETPOS, csaveditems, 0);
+            for (size_t i = 0; i < m_vedit.size(); i++)
+            {
+               IEditable *const piedit = m_vedit[i];
+               EncodedItem encoded { nullptr, S_OK };
+               if (encodedItems[i].valid())
+                  encoded = encodedItems[i].get();
+               else if (!autoSave || !piedit->m_autoSaveData)
+                  encoded.pstm = encodeStream([&encoded, encodeItem, piedit](IStream *pstm) { encoded.hr = encodeItem(pstm, piedit); });
+               if (FAILED(encoded.hr))
+                  failedItems.push_back(piedit);
+               storeStream("GameItem" + std::to_string(i), encoded.pstm, piedit->m_autoSaveData);
+               //if (FAILED(hr)) goto Error;
             }
+            const U64 itemsEnd = usec();
+
+            for (size_t i = 0; i < m_vsound.size(); i++)
+               storeStream("Sound" + std::to_string(i), encodedSounds[i].valid() ? encodedSounds[i].get() : nullptr, m_vsound[i]->m_autoSaveData);
+            const U64 soundsEnd = usec();
 
             for (size_t i = 0; i < m_vimage.size(); i++)
-            {
-               const string szStmName = "Image" + std::to_string(i);
-               MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
+               storeStream("Image" + std::to_string(i), encodedImages[i].valid() ? encodedImages[i].get() : nullptr, m_vimage[i]->m_autoSaveData);
+            const U64 imagesEnd = usec();
 
-               if (SUCCEEDED(hr = pstgData->CreateStream(wszStmName, STGM_DIRECT | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | STGM_CREATE, 0, 0, &pstmItem)))
-               {
-                  m_vimage[i]->SaveToStream(pstmItem, this);
-                  pstmItem->Release();
-                  pstmItem = nullptr;
-               }
+            PLOGI << (autoSave ? "Table items autosaved in " : "Table items saved in ") << ((imagesEnd - encodeStart) / 1000) << "ms (game items: " << ((itemsEnd - encodeStart) / 1000)
+                  << "ms, sounds: " << ((soundsEnd - itemsEnd) / 1000) << "ms, images: " << ((imagesEnd - soundsEnd) / 1000) << "ms)";
 
-               csaveditems++;
-               ::SendMessage(hwndProgressBar, PBM_SETPOS, csaveditems, 0);
+            if (!failedItems.empty())
+            {
+               string names;
+               for (IEditable *const piedit : failedItems)
+                  names += (names.empty() ? ""s : ", "s) + piedit->GetName();
+               ShowError("Could not save the data of: " + names);
             }
 
             for (size_t i = 0; i < m_vfont.size(); i++)
@@ -3702,7 +3817,7 @@ HRESULT PinTable::LoadGameFromFilename(const string& szFileName)
             // due to multithreaded loading and pre-allocation, check if some images could not be loaded, and perform a retry since more memory is available now
             string failed_load_img;
             for (size_t i = 0; i < m_vimage.size(); ++i)
-                if (!m_vimage[i] || m_vimage[i]->m_pdsBuffer == nullptr)
+                if (!m_vimage[i] || !m_vimage[i]->IsLoaded())
                 {
                     const string szStmName = "Image" + std::to_string(i);
                     MAKE_WIDEPTR_FROMANSI(wszStmName, szStmName.c_str());
@@ -3718,7 +3833,7 @@ HRESULT PinTable::LoadGameFromFilename(const string& szFileName)
                         }
                     }
 
-                    if (!m_vimage[i] || m_vimage[i]->m_pdsBuffer == nullptr)
+                    if (!m_vimage[i] || !m_vimage[i]->IsLoaded())
                         failed_load_img += '\n' + (m_vimage[i] ? m_vimage[i]->m_szName : szStmName);
                     else if ((m_vimage[i]->m_realWidth > m_vimage[i]->m_width) || (m_vimage[i]->m_realHeight > m_vimage[i]->m_height)) { //!! do not warn on resize, as original image file/binary blob is always loaded into mem! (otherwise table load failure is triggered) {
                         PLOGW << "Image '" << m_vimage[i]->m_szName << "' was downsized from " << m_vimage[i]->m_realWidth << 'x' << m_vimage[i]->m_realHeight << " to " << m_vimage[i]->m_width << 'x' << m_vimage[i]->m_height << " due to low memory ";
@@ -3736,7 +3851,7 @@ HRESULT PinTable::LoadGameFromFilename(const string& szFileName)
 
             // check if some images could not be loaded and erase them
             for (size_t i = 0; i < m_vimage.size(); ++i)
-                if (!m_vimage[i] || m_vimage[i]->m_pdsBuffer == nullptr)
+                if (!m_vimage[i] || !m_vimage[i]->IsLoaded())
                 {
                     m_vimage.erase(m_vimage.begin()+i);
                     --i;
@@ -6243,6 +6358,8 @@ void PinTable::SetDirty(SaveDirtyState sds)
 
 void PinTable::SetNonUndoableDirty(SaveDirtyState sds)
 {
+   if (sds == eSaveDirty) // the modified objects are not known, so they all have to be encoded again on next autosave
+      InvalidateAutoSaveData();
    m_sdsNonUndoableDirty = sds;
    CheckDirty();
 }
@@ -6963,16 +7080,11 @@ STDMETHODIMP PinTable::PlaySound(BSTR bstr, int loopcount, float volume, float p
    char szName[MAXSTRING];
    WideCharToMultiByteNull(CP_ACP, 0, bstr, -1, szName, MAXSTRING, nullptr, nullptr);
 
-   if (!lstrcmpi("knock", szName) || !lstrcmpi("knocker", szName))
-      ushock_knock();
-
-   size_t i;
-   for (i = 0; i < m_vsound.size(); i++)
-      if (!lstrcmpi(m_vsound[i]->m_szName.c_str(), szName))
-         break;
-
-   if (i == m_vsound.size()) // did not find it
+   PinSound * const pps = GetSound(szName);
+   if (pps == nullptr) // did not find it
    {
+      if (!lstrcmpi("knock", szName) || !lstrcmpi("knocker", szName))
+         ushock_knock();
       if (szName[0] && m_pcv && g_pplayer && g_pplayer->m_hwndDebugOutput)
       {
          const string logmsg = "Request to play \""s + szName + "\", but sound not found.";
@@ -6981,7 +7093,16 @@ STDMETHODIMP PinTable::PlaySound(BSTR bstr, int loopcount, float volume, float p
       return S_OK;
    }
 
-   PinSound * const pps = m_vsound[i];
+   PlaySound(pps, loopcount, volume, pan, randompitch, pitch, VBTOb(usesame), VBTOb(restart), front_rear_fade);
+
+   return S_OK;
+}
+
+// Play an already resolved sound (see GetSound), for sounds triggered repeatedly by the table elements themselves
+void PinTable::PlaySound(PinSound *const pps, const int loopcount, float volume, float pan, const float randompitch, const int pitch, const bool usesame, const bool restart, float front_rear_fade)
+{
+   if (!lstrcmpi("knock", pps->m_szName.c_str()) || !lstrcmpi("knocker", pps->m_szName.c_str()))
+      ushock_knock();
 
    volume += dequantizeSignedPercent(pps->m_volume);
    pan += dequantizeSignedPercent(pps->m_balance);
@@ -6990,9 +7111,19 @@ STDMETHODIMP PinTable::PlaySound(BSTR bstr, int loopcount, float volume, float p
    if (m_tblMirrorEnabled)
       pan = -pan;
 
-   m_vpinball->m_ps.Play(pps, volume * m_TableSoundVolume * (float)g_pplayer->m_SoundVolume, randompitch, pitch, pan, front_rear_fade, loopcount, VBTOb(usesame), VBTOb(restart));
+   m_vpinball->m_ps.Play(pps, volume * m_TableSoundVolume * (float)g_pplayer->m_SoundVolume, randompitch, pitch, pan, front_rear_fade, loopcount, usesame, restart);
+}
 
-   return S_OK;
+PinSound *PinTable::GetSound(const string &szName) const
+{
+   if (szName.empty())
+      return nullptr;
+
+   for (size_t i = 0; i < m_vsound.size(); i++)
+      if (!lstrcmpi(m_vsound[i]->m_szName.c_str(), szName.c_str()))
+         return m_vsound[i];
+
+   return nullptr;
 }
 
 RenderProbe *PinTable::GetRenderProbe(const string &szName) const
@@ -7069,7 +7200,7 @@ bool PinTable::ExportImage(const Texture * const ppi, const char * const szfilen
 {
    if (ppi->m_ppb != nullptr)
       return ppi->m_ppb->WriteToFile(szfilename);
-   else if (ppi->m_pdsBuffer != nullptr)
+   else if (ppi->GetRawBitmapIfDecoded() != nullptr)
    {
 #if 0
       HANDLE hFile = CreateFile(szfilename, GENERIC_WRITE, FILE_SHARE_READ,
@@ -7122,8 +7253,8 @@ bool PinTable::ExportImage(const Texture * const ppi, const char * const szfilen
       unsigned char* info;
       for (info = sinfo + surfwidth * 3; info < sinfo + bmplnsize; *info++ = 0); //fill padding with 0			
 
-      const unsigned int pitch = ppi->m_pdsBuffer->pitch();
-      const BYTE *spch = ppi->m_pdsBuffer->data() + (surfheight * pitch); // just past the end of the Texture part of DD surface
+      const unsigned int pitch = ppi->GetRawBitmapIfDecoded()->pitch();
+      const BYTE *spch = ppi->GetRawBitmapIfDecoded()->data() + (surfheight * pitch); // just past the end of the Texture part of DD surface
 
       for (unsigned int i = 0; i < surfheight; i++)
       {
@@ -7137,19 +7268,19 @@ bool PinTable::ExportImage(const Texture * const ppi, const char * const szfilen
       delete[] sinfo;
       CloseHandle(hFile);
 #else
-      if (ppi->m_pdsBuffer->m_format == BaseTexture::RGB_FP16 || ppi->m_pdsBuffer->m_format == BaseTexture::RGB_FP32)
+      if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::RGB_FP16 || ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::RGB_FP32)
       {
           assert(!"float format export");
           return false; // Unsupported but this should not happen since all HDR images are imported and have a m_ppb field
       }
 
-      FIBITMAP *dib = FreeImage_Allocate(ppi->m_width, ppi->m_height, ppi->m_pdsBuffer->has_alpha() ? 32 : 24);
+      FIBITMAP *dib = FreeImage_Allocate(ppi->m_width, ppi->m_height, ppi->GetRawBitmapIfDecoded()->has_alpha() ? 32 : 24);
       BYTE *const psrc = FreeImage_GetBits(dib);
 
-      const unsigned int pitch = ppi->m_pdsBuffer->pitch();
+      const unsigned int pitch = ppi->GetRawBitmapIfDecoded()->pitch();
       const unsigned int pitch_dst = FreeImage_GetPitch(dib);
-      const BYTE *spch = ppi->m_pdsBuffer->data() + (ppi->m_height * pitch); // just past the end of the Texture part of DD surface
-      const unsigned int ch = ppi->m_pdsBuffer->has_alpha() ? 4 : 3;
+      const BYTE *spch = ppi->GetRawBitmapIfDecoded()->data() + (ppi->m_height * pitch); // just past the end of the Texture part of DD surface
+      const unsigned int ch = ppi->GetRawBitmapIfDecoded()->has_alpha() ? 4 : 3;
 
       for (unsigned int i = 0; i < ppi->m_height; i++)
       {
@@ -7160,7 +7291,7 @@ bool PinTable::ExportImage(const Texture * const ppi, const char * const szfilen
             dst[0] = src[2];
             dst[1] = src[1];
             dst[2] = src[0];
-            if (ppi->m_pdsBuffer->has_alpha())
+            if (ppi->GetRawBitmapIfDecoded()->has_alpha())
                dst[3] = src[3];
          }
       }
@@ -7201,7 +7332,7 @@ Texture *PinTable::ImportImage(const string &filename, const string &imagename)
       isUpdate = false;
    }
    ppi->LoadFromFile(filename, imagename.empty());
-   if (ppi->m_pdsBuffer == nullptr)
+   if (ppi->GetRawBitmapIfDecoded() == nullptr)
    {
       if (!isUpdate)
          delete ppi;
@@ -7248,34 +7379,34 @@ int PinTable::AddListImage(HWND hwndListView, Texture * const ppi)
    ListView_SetItemText(hwndListView, index, 2, sizeString);
    ListView_SetItemText(hwndListView, index, 3, (LPSTR)usedStringNo);
 
-   char *const sizeConv = StrFormatByteSize64(ppi->m_pdsBuffer->height() * ppi->m_pdsBuffer->pitch(), sizeString, MAXTOKEN);
+   char *const sizeConv = StrFormatByteSize64(ppi->GetRawBitmapSize(), sizeString, MAXTOKEN);
    ListView_SetItemText(hwndListView, index, 4, sizeConv);
 
-   if (ppi->m_pdsBuffer == nullptr)
+   if (ppi->GetRawBitmapIfDecoded() == nullptr)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"-");
    }
-   else if (ppi->m_pdsBuffer->m_format == BaseTexture::SRGB)
+   else if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::SRGB)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"sRGB");
    }
-   else if (ppi->m_pdsBuffer->m_format == BaseTexture::SRGBA)
+   else if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::SRGBA)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"sRGBA");
    }
-   else if (ppi->m_pdsBuffer->m_format == BaseTexture::RGB)
+   else if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::RGB)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"RGB");
    }
-   else if (ppi->m_pdsBuffer->m_format == BaseTexture::RGBA)
+   else if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::RGBA)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"RGBA");
    }
-   else if (ppi->m_pdsBuffer->m_format == BaseTexture::RGB_FP16)
+   else if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::RGB_FP16)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"RGB 16F");
    }
-   else if (ppi->m_pdsBuffer->m_format == BaseTexture::RGB_FP32)
+   else if (ppi->GetRawBitmapIfDecoded()->m_format == BaseTexture::RGB_FP32)
    {
       ListView_SetItemText(hwndListView, index, 5, (LPSTR)"RGB 32F");
    }
@@ -7793,7 +7924,7 @@ void PinTable::AuditTable() const
       if (type == eItemPrimitive && prim->m_d.m_visible
          && prim->m_d.m_disableLightingBelow != 1.f && !prim->m_d.m_staticRendering 
          && (!GetMaterial(prim->m_d.m_szMaterial)->m_bOpacityActive || GetMaterial(prim->m_d.m_szMaterial)->m_fOpacity == 1.f)
-         && (GetImage(prim->m_d.m_szImage) == nullptr || GetImage(prim->m_d.m_szImage)->m_pdsBuffer->IsOpaque()))
+         && (GetImage(prim->m_d.m_szImage) == nullptr || GetImage(prim->m_d.m_szImage)->GetRawBitmap()->IsOpaque()))
          ss << ". Warning: Primitive '" << prim->GetName() << "' uses translucency (lighting from below) while it is fully opaque. Translucency will be discarded.\r\n";
 
       // Disabled as this is now enforced in the rendering
@@ -7836,8 +7967,8 @@ void PinTable::AuditTable() const
    totalSize = 0;
    for (auto image : m_vimage)
    {
-      unsigned int imageSize = image->m_ppb != nullptr ? image->m_ppb->m_cdata : image->m_pdsBuffer->height() * image->m_pdsBuffer->pitch();
-      unsigned int gpuSize = image->m_pdsBuffer->height() * image->m_pdsBuffer->pitch();
+      unsigned int imageSize = image->m_ppb != nullptr ? image->m_ppb->m_cdata : (unsigned int)image->GetRawBitmapSize();
+      unsigned int gpuSize = (unsigned int)image->GetRawBitmapSize();
       //ss << "  . Image: '" << image->m_szName << "', size: " << (imageSize / 1024) << "KiB, GPU mem size: " << (gpuSize / 1024) << "KiB\r\n";
       totalSize += imageSize;
       totalGpuSize += gpuSize;
@@ -7892,7 +8023,8 @@ HRESULT PinTable::LoadImageFromStream(IStream *pstm, size_t idx, int version, bo
    else
    {
       Texture * const ppi = new Texture();
-      ppi->m_maxTexDim = m_settings.LoadValueWithDefault(Settings::Player, "MaxTexDimension"s, 0); // default: Don't resize textures
+      ppi->m_maxTexDim = m_settings.LoadInt(Settings::Player_MaxTexDimension); // default: Don't resize textures
+      ppi->m_lazyDecode = m_settings.LoadValueWithDefault(Settings::Player, "LazyImageDecoding"s, false);
       if (ppi->LoadFromStream(pstm, version, this, resize_on_low_mem) == S_OK)
          m_vimage[idx] = ppi;
       else
@@ -7902,6 +8034,44 @@ HRESULT PinTable::LoadImageFromStream(IStream *pstm, size_t idx, int version, bo
    return S_OK;
 }
 
+void PinTable::GetUsedImages(vector<Texture *> &images) const
+{
+   const auto addImage = [this, &images](const string &name)
+   {
+      Texture *const image = GetImage(name);
+      if (image && FindIndexOf(images, image) == -1)
+         images.push_back(image);
+   };
+
+   addImage(m_image);
+   addImage(m_ballImage);
+   addImage(m_ballImageDecal);
+   addImage(m_envImage);
+   addImage(m_imageColorGrade);
+   for (int i = 0; i < NUM_BG_SETS; i++)
+      addImage(m_BG_image[i]);
+
+   for (IEditable *const pEdit : m_vedit)
+   {
+      switch (pEdit->GetItemType())
+      {
+      case eItemPrimitive: addImage(((Primitive *)pEdit)->m_d.m_szImage); addImage(((Primitive *)pEdit)->m_d.m_szNormalMap); break;
+      case eItemRamp: addImage(((Ramp *)pEdit)->m_d.m_szImage); break;
+      case eItemSurface: addImage(((Surface *)pEdit)->m_d.m_szImage); addImage(((Surface *)pEdit)->m_d.m_szSideImage); break;
+      case eItemDecal: addImage(((Decal *)pEdit)->m_d.m_szImage); break;
+      case eItemFlipper: addImage(((Flipper *)pEdit)->m_d.m_szImage); break;
+      case eItemHitTarget: addImage(((HitTarget *)pEdit)->m_d.m_szImage); break;
+      case eItemPlunger: addImage(((Plunger *)pEdit)->m_d.m_szImage); break;
+      case eItemSpinner: addImage(((Spinner *)pEdit)->m_d.m_szImage); break;
+      case eItemRubber: addImage(((Rubber *)pEdit)->m_d.m_szImage); break;
+      case eItemDispReel: addImage(((DispReel *)pEdit)->m_d.m_szImage); break;
+      case eItemFlasher: addImage(((Flasher *)pEdit)->m_d.m_szImageA); addImage(((Flasher *)pEdit)->m_d.m_szImageB); break;
+      case eItemLight: addImage(((Light *)pEdit)->m_d.m_szImage); break;
+      default: break;
+      }
+   }
+}
+
 STDMETHODIMP PinTable::get_Image(BSTR *pVal)
 {
    WCHAR wz[MAXTOKEN];
@@ -8724,7 +8894,7 @@ STDMETHODIMP PinTable::get_BallTrail(UserDefaultOnOff *pVal)
    if (!m_settings.HasValue(Settings::Player, "BallTrail"s))
       *pVal = UserDefaultOnOff::Default;
    else
-      *pVal = m_settings.LoadValueWithDefault(Settings::Player, "BallTrail"s, true) ? UserDefaultOnOff::On : UserDefaultOnOff::Off;
+      *pVal = m_settings.LoadBool(Settings::Player_BallTrail) ? UserDefaultOnOff::On : UserDefaultOnOff::Off;
    return S_OK;
 }
 
@@ -8736,13 +8906,13 @@ STDMETHODIMP PinTable::put_BallTrail(UserDefaultOnOff newVal)
       m_settings.SaveValue(Settings::Player, "BallTrail"s, newVal == 1, true);
    if (g_pplayer)
       g_pplayer->m_trailForBalls = (newVal == UserDefaultOnOff::On)
-         || ((newVal == UserDefaultOnOff::Default) && m_settings.LoadValueWithDefault(Settings::Player, "BallTrail"s, true));
+         || ((newVal == UserDefaultOnOff::Default) && m_settings.LoadBool(Settings::Player_BallTrail));
    return S_OK;
 }
 
 STDMETHODIMP PinTable::get_TrailStrength(int *pVal)
 {
-   *pVal = static_cast<int>(100.f * m_settings.LoadValueWithDefault(Settings::Player, "BallTrailStrength"s, 0.5f));
+   *pVal = static_cast<int>(100.f * m_settings.LoadFloat(Settings::Player_BallTrailStrength));
    return S_OK;
 }
 
@@ -42,6 +42,11 @@ struct ProtectionData
 };
 
 class ScriptGlobalTable;
+class RenderDevice;
+class BaseTexture;
+
+// Update a DMD texture from a frame submitted by script (see ScriptGlobalTable::put_DMDPixels and Flasher::put_DMDPixels)
+void UpdateDMDTexture(RenderDevice* const rd, BaseTexture*& tex, vector<DWORD>& lastFrame, const int2& dmdSize, const VARIANT& pVal, const bool isColored);
 
 class PinTableMDI : public CMDIChild
 {
@@ -216,6 +221,7 @@ public:
    STDMETHOD(put_Image)(/*[in]*/ BSTR newVal);
 
    STDMETHOD(PlaySound)(BSTR bstr, int loopcount, float volume, float pan, float randompitch, int pitch, VARIANT_BOOL usesame, VARIANT_BOOL restart, float front_rear_fade);
+   void PlaySound(PinSound *const pps, const int loopcount, float volume, float pan, const float randompitch, const int pitch, const bool usesame, const bool restart, float front_rear_fade);
    STDMETHOD(FireKnocker)(/*[in]*/ int Count);
    STDMETHOD(QuitPlayer)(/*[in]*/ int CloseType);
 
@@ -379,7 +385,9 @@ public:
    int AddListImage(HWND hwndListView, Texture *const ppi);
    void RemoveImage(Texture *const ppi);
    HRESULT LoadImageFromStream(IStream *pstm, size_t idx, int version, bool resize_on_low_mem);
+   void GetUsedImages(vector<Texture *> &images) const; // images referenced by the table and part properties (images set by script are not included)
    Texture *GetImage(const string &szName) const;
+   PinSound *GetSound(const string &szName) const;
    bool GetImageLink(const Texture *const ppi) const;
    PinBinary *GetImageLinkBinary(const int id);
    Light *GetLight(const string &szName) const;
@@ -460,12 +468,13 @@ public:
    void BeginAutoSaveCounter();
    void EndAutoSaveCounter();
    void AutoSave();
+   void InvalidateAutoSaveData(); // to be called on modifications not tracked by the undo system
 
    HRESULT TableSave();
    HRESULT SaveAs();
    virtual HRESULT ApcProject_Save();
    HRESULT Save(const bool saveAs);
-   HRESULT SaveToStorage(IStorage *pstg);
+   HRESULT SaveToStorage(IStorage *pstg, const bool autoSave = false); // for autosave, pstg must be a FastIStorage
    HRESULT SaveInfo(IStorage *pstg, HCRYPTHASH hcrypthash);
    HRESULT SaveCustomInfo(IStorage *pstg, IStream *pstmTags, HCRYPTHASH hcrypthash);
    HRESULT WriteInfoValue(IStorage *pstg, const WCHAR *const wzName, const string &szValue, HCRYPTHASH hcrypthash);
@@ -913,6 +922,7 @@ public:
    STDMETHOD(get_PlatformCPU)(/*[out, retval]*/ BSTR *pVal);
    STDMETHOD(get_PlatformBits)(/*[out, retval]*/ BSTR *pVal);
    STDMETHOD(put_ShowCursor)(/*[in]*/ VARIANT_BOOL enable);
+   STDMETHOD(SetEventCoalescing)(/*[in]*/ IDispatch *pObject, /*[in]*/ VARIANT_BOOL enable);
    STDMETHOD(get_StartGameKey)(/*[out, retval]*/ long *pVal);
    STDMETHOD(PlayMusic)(BSTR str, float volume);
    STDMETHOD(put_MusicVolume)(float volume);
@@ -9,6 +9,8 @@
 #include "progmesh.h"
 #include "ThreadPool.h"
 #include "renderer/Shader.h"
+#include <fstream>
+#include <filesystem>
 
 ThreadPool *g_pPrimitiveDecompressThreadPool = nullptr;
 
@@ -480,6 +482,79 @@ void Primitive::GetTimers(vector<HitTimer*> &pvht)
    IEditable::BeginPlay();
 }
 
+// The progressive mesh reduction of the collision mesh is by far the most expensive part of the physics setup of large primitives,
+// while its result only depends on the transformed mesh and the reduction factor, so it is cached on disk between runs
+// (in the table cache folder, one file per primitive, keyed by a hash of the reduction input).
+struct HitMeshCacheHeader
+{
+   unsigned int magic;
+   unsigned int version;
+   uint64_t key;
+   unsigned int nVertices;
+   unsigned int nTriangles;
+};
+
+static constexpr unsigned int HITMESH_CACHE_MAGIC = 0x4D485056; // 'VPHM'
+static constexpr unsigned int HITMESH_CACHE_VERSION = 1;
+
+static string GetHitMeshCachePath(const PinTable * const ptable, const char * const name)
+{
+   if (!g_pplayer->m_hitMeshCacheEnabled)
+      return string();
+   string filename(name);
+   for (char &c : filename)
+      if (!isalnum((unsigned char)c) && c != '_' && c != '-')
+         c = '_';
+   return g_pvp->m_szMyPrefPath + "Cache" + PATH_SEPARATOR_CHAR + ptable->m_szTitle + PATH_SEPARATOR_CHAR + filename + ".hitmesh";
+}
+
+static uint64_t GetHitMeshCacheKey(const vector<ProgMesh::float3> &vertices, const vector<ProgMesh::tridata> &indices, const unsigned int reduced_vertices)
+{
+   const uint64_t hv = robin_hood::hash_bytes(vertices.data(), vertices.size() * sizeof(ProgMesh::float3));
+   const uint64_t hi = robin_hood::hash_bytes(indices.data(), indices.size() * sizeof(ProgMesh::tridata));
+   return (hv << 32) ^ (hv >> 32) ^ hi ^ ((uint64_t)reduced_vertices * 0x9E3779B97F4A7C15ull);
+}
+
+static bool LoadHitMeshCache(const string &path, const uint64_t key, vector<ProgMesh::float3> &vertices, vector<ProgMesh::tridata> &indices)
+{
+   std::ifstream file(path, std::ios::binary);
+   if (!file)
+      return false;
+   HitMeshCacheHeader header;
+   if (!file.read((char *)&header, sizeof(header)) || header.magic != HITMESH_CACHE_MAGIC || header.version != HITMESH_CACHE_VERSION || header.key != key
+      || header.nVertices != vertices.size())
+      return false;
+   vector<ProgMesh::float3> cachedVertices(header.nVertices);
+   vector<ProgMesh::tridata> cachedIndices(header.nTriangles);
+   if (!file.read((char *)cachedVertices.data(), cachedVertices.size() * sizeof(ProgMesh::float3))
+      || !file.read((char *)cachedIndices.data(), cachedIndices.size() * sizeof(ProgMesh::tridata)))
+      return false;
+   for (const ProgMesh::tridata &t : cachedIndices)
+      if (t.v[0] >= header.nVertices || t.v[1] >= header.nVertices || t.v[2] >= header.nVertices)
+         return false;
+   vertices = std::move(cachedVertices);
+   indices = std::move(cachedIndices);
+   return true;
+}
+
+static void SaveHitMeshCache(const string &path, const uint64_t key, const vector<ProgMesh::float3> &vertices, const vector<ProgMesh::tridata> &indices)
+{
+   std::error_code ec;
+   std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   if (!file)
+      return;
+   const HitMeshCacheHeader header = { HITMESH_CACHE_MAGIC, HITMESH_CACHE_VERSION, key, (unsigned int)vertices.size(), (unsigned int)indices.size() };
+   file.write((const char *)&header, sizeof(header));
+   file.write((const char *)vertices.data(), vertices.size() * sizeof(ProgMesh::float3));
+   file.write((const char *)indices.data(), indices.size() * sizeof(ProgMesh::tridata));
+   if (!file)
+   {
+      file.close();
+      std::filesystem::remove(path, ec);
+   }
+}
+
 void Primitive::GetHitShapes(vector<HitObject*> &pvho)
 {
    char name[sizeof(m_wzName)/sizeof(m_wzName[0])];
@@ -527,16 +602,24 @@ void Primitive::GetHitShapes(vector<HitObject*> &pvho)
       if (i2 < prog_indices.size())
          prog_indices.resize(i2);
       }
-      vector<unsigned int> prog_map;
-      vector<unsigned int> prog_perm;
-      ProgMesh::ProgressiveMesh(prog_vertices, prog_indices, prog_map, prog_perm);
-      ProgMesh::PermuteVertices(prog_perm, prog_vertices, prog_indices);
-      prog_perm.clear();
-
       vector<ProgMesh::tridata> prog_new_indices;
-      ProgMesh::ReMapIndices(reduced_vertices, prog_indices, prog_new_indices, prog_map);
+      const string cachePath = GetHitMeshCachePath(m_ptable, name);
+      const uint64_t cacheKey = cachePath.empty() ? 0 : GetHitMeshCacheKey(prog_vertices, prog_indices, reduced_vertices);
+      if (cachePath.empty() || !LoadHitMeshCache(cachePath, cacheKey, prog_vertices, prog_new_indices))
+      {
+         vector<unsigned int> prog_map;
+         vector<unsigned int> prog_perm;
+         ProgMesh::ProgressiveMesh(prog_vertices, prog_indices, prog_map, prog_perm);
+         ProgMesh::PermuteVertices(prog_perm, prog_vertices, prog_indices);
+         prog_perm.clear();
+
+         ProgMesh::ReMapIndices(reduced_vertices, prog_indices, prog_new_indices, prog_map);
+         prog_map.clear();
+
+         if (!cachePath.empty())
+            SaveHitMeshCache(cachePath, cacheKey, prog_vertices, prog_new_indices);
+      }
       prog_indices.clear();
-      prog_map.clear();
 
       //
 
@@ -1195,23 +1278,7 @@ void Primitive::ExportMesh(ObjLoader& loader)
       WideCharToMultiByteNull(CP_ACP, 0, m_wzName, -1, name, sizeof(name), nullptr, nullptr);
       Vertex3D_NoTex2 *const buf = new Vertex3D_NoTex2[m_mesh.NumVertices()];
       RecalculateMatrices();
-      for (size_t i = 0; i < m_mesh.NumVertices(); i++)
-      {
-         const Vertex3D_NoTex2 &v = m_mesh.m_vertices[i];
-         Vertex3Ds vert(v.x, v.y, v.z);
-         vert = m_fullMatrix.MultiplyVector(vert);
-         buf[i].x = vert.x;
-         buf[i].y = vert.y;
-         buf[i].z = vert.z;
-
-         vert = Vertex3Ds(v.nx, v.ny, v.nz);
-         vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-         buf[i].nx = vert.x;
-         buf[i].ny = vert.y;
-         buf[i].nz = vert.z;
-         buf[i].tu = v.tu;
-         buf[i].tv = v.tv;
-      }
+      m_fullMatrix.TransformVertices(m_mesh.m_vertices.data(), buf, (int)m_mesh.NumVertices());
       loader.WriteObjectName(name);
       loader.WriteVertexInfo(buf, (unsigned int)m_mesh.NumVertices());
       const Material * const mat = m_ptable->GetMaterial(m_d.m_szMaterial);
@@ -1354,7 +1421,7 @@ void Primitive::Render(const unsigned int renderMask)
       Texture * const img = m_ptable->GetImage(m_d.m_szImage);
       if (img != nullptr)
       {
-         pin = img->m_pdsBuffer;
+         pin = img->GetRawBitmap();
          pinAlphaTest = img->m_alphaTestValue;
          m_rd->basicShader->SetAlphaTestValue(img->m_alphaTestValue);
       }
@@ -1565,6 +1632,97 @@ void Primitive::PutCenter(const Vertex2D& pv)
 // Save and Load
 //////////////////////////////
 
+// Quantized vertex encoding, used to save meshes when the Editor/MeshQuantization setting is enabled (M3QX token, see QUANTIZED_MESH_FORMAT_VERSION):
+// - a header of 10 floats: position minimum (3), position scale (3), texture coordinate minimum (2), texture coordinate scale (2),
+// - positions and texture coordinates as 16 bit values relative to the mesh bounds, normals as 16 bit octahedral coordinates,
+//   each component being stored as a separate array as this compresses better than interleaved data.
+static constexpr size_t QUANTIZED_MESH_HEADER_SIZE = 10 * sizeof(float);
+
+static size_t GetQuantizedMeshSize(const size_t numVertices)
+{
+   return QUANTIZED_MESH_HEADER_SIZE + numVertices * 7 * sizeof(uint16_t);
+}
+
+static void QuantizeMesh(const vector<Vertex3D_NoTex2> &vertices, vector<uint8_t> &data)
+{
+   const size_t n = vertices.size();
+   float vmin[5] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX }, vmax[5] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+   for (const Vertex3D_NoTex2 &v : vertices)
+   {
+      const float c[5] = { v.x, v.y, v.z, v.tu, v.tv };
+      for (int j = 0; j < 5; j++)
+      {
+         vmin[j] = min(vmin[j], c[j]);
+         vmax[j] = max(vmax[j], c[j]);
+      }
+   }
+
+   float header[10], invScale[5];
+   for (int j = 0; j < 5; j++)
+   {
+      if (n == 0)
+         vmin[j] = vmax[j] = 0.f;
+      const float scale = (vmax[j] - vmin[j]) * (float)(1.0 / 65535.0);
+      invScale[j] = scale > 0.f ? 1.0f / scale : 0.f;
+      header[j < 3 ? j : j + 3] = vmin[j];
+      header[j < 3 ? j + 3 : j + 5] = scale;
+   }
+
+   data.resize(GetQuantizedMeshSize(n));
+   memcpy(data.data(), header, QUANTIZED_MESH_HEADER_SIZE);
+   uint16_t * const __restrict q = (uint16_t *)(data.data() + QUANTIZED_MESH_HEADER_SIZE);
+   for (size_t i = 0; i < n; i++)
+   {
+      const Vertex3D_NoTex2 &v = vertices[i];
+      q[i        ] = (uint16_t)clamp((v.x  - vmin[0]) * invScale[0] + 0.5f, 0.f, 65535.f);
+      q[i + n    ] = (uint16_t)clamp((v.y  - vmin[1]) * invScale[1] + 0.5f, 0.f, 65535.f);
+      q[i + n * 2] = (uint16_t)clamp((v.z  - vmin[2]) * invScale[2] + 0.5f, 0.f, 65535.f);
+      q[i + n * 5] = (uint16_t)clamp((v.tu - vmin[3]) * invScale[3] + 0.5f, 0.f, 65535.f);
+      q[i + n * 6] = (uint16_t)clamp((v.tv - vmin[4]) * invScale[4] + 0.5f, 0.f, 65535.f);
+
+      // Octahedral normal encoding: project on the octahedron, then fold the lower hemisphere over the upper one
+      const float l1 = fabsf(v.nx) + fabsf(v.ny) + fabsf(v.nz);
+      float ox = l1 > 0.f ? v.nx / l1 : 0.f;
+      float oy = l1 > 0.f ? v.ny / l1 : 0.f;
+      if (v.nz < 0.f)
+      {
+         const float fx = (1.0f - fabsf(oy)) * (ox >= 0.f ? 1.0f : -1.0f);
+         oy = (1.0f - fabsf(ox)) * (oy >= 0.f ? 1.0f : -1.0f);
+         ox = fx;
+      }
+      q[i + n * 3] = (uint16_t)(int16_t)clamp(ox * 32767.f + (ox >= 0.f ? 0.5f : -0.5f), -32767.f, 32767.f);
+      q[i + n * 4] = (uint16_t)(int16_t)clamp(oy * 32767.f + (oy >= 0.f ? 0.5f : -0.5f), -32767.f, 32767.f);
+   }
+}
+
+// Simple branchless loop over separate component arrays, so that the compiler can vectorize it
+static void DequantizeMesh(const uint8_t * const data, const size_t n, Vertex3D_NoTex2 * const __restrict vertices)
+{
+   float header[10];
+   memcpy(header, data, QUANTIZED_MESH_HEADER_SIZE);
+   const uint16_t * const __restrict q = (const uint16_t *)(data + QUANTIZED_MESH_HEADER_SIZE);
+   const int16_t * const __restrict oct = (const int16_t *)q;
+   for (size_t i = 0; i < n; i++)
+   {
+      Vertex3D_NoTex2 &v = vertices[i];
+      v.x = header[0] + (float)q[i] * header[3];
+      v.y = header[1] + (float)q[i + n] * header[4];
+      v.z = header[2] + (float)q[i + n * 2] * header[5];
+      v.tu = header[6] + (float)q[i + n * 5] * header[8];
+      v.tv = header[7] + (float)q[i + n * 6] * header[9];
+
+      float nx = (float)oct[i + n * 3] * (float)(1.0 / 32767.0);
+      float ny = (float)oct[i + n * 4] * (float)(1.0 / 32767.0);
+      const float nz = 1.0f - fabsf(nx) - fabsf(ny);
+      const float t = max(-nz, 0.f);
+      nx += nx >= 0.f ? -t : t;
+      ny += ny >= 0.f ? -t : t;
+      const float invLength = 1.0f / sqrtf(nx * nx + ny * ny + nz * nz);
+      v.nx = nx * invLength;
+      v.ny = ny * invLength;
+      v.nz = nz * invLength;
+   }
+}
 
 HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool saveForUndo)
 {
@@ -1615,9 +1773,13 @@ HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool sav
    bw.WriteBool(FID(DIPT), m_d.m_displayTexture);
    bw.WriteBool(FID(OSNM), m_d.m_objectSpaceNormalMap);
 
+   // Compression failures are returned instead of shown, as this may run on a save worker thread
+   bool compressFailed = false;
    // Don't save the meshes for undo/redo
    if (m_d.m_use3DMesh && !saveForUndo)
    {
+      const int compressionLevel = clamp(g_pvp->m_settings.LoadValueWithDefault(Settings::Editor, "MeshCompressionLevel"s, (int)MZ_BEST_COMPRESSION), 0, (int)MZ_BEST_COMPRESSION);
+      const bool quantize = g_pvp->m_settings.LoadValueWithDefault(Settings::Editor, "MeshQuantization"s, false);
       bw.WriteString(FID(M3DN), m_d.m_meshFileName);
       bw.WriteInt(FID(M3VN), (int)m_mesh.NumVertices());
 
@@ -1630,13 +1792,16 @@ HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool sav
       lzwwriter.CompressBits(8 + 1);
       }*/
       {
-      const mz_ulong slen = (mz_ulong)(sizeof(Vertex3D_NoTex2)*m_mesh.NumVertices());
+      vector<uint8_t> quantized;
+      if (quantize)
+         QuantizeMesh(m_mesh.m_vertices, quantized);
+      const mz_ulong slen = quantize ? (mz_ulong)quantized.size() : (mz_ulong)(sizeof(Vertex3D_NoTex2)*m_mesh.NumVertices());
       mz_ulong clen = compressBound(slen);
       mz_uint8 * c = (mz_uint8 *)malloc(clen);
-      if (compress2(c, &clen, (const unsigned char *)m_mesh.m_vertices.data(), slen, MZ_BEST_COMPRESSION) != Z_OK)
-         ShowError("Could not compress primitive vertex data");
-      bw.WriteInt(FID(M3CY), (int)clen);
-      bw.WriteStruct(FID(M3CX), c, clen);
+      if (compress2(c, &clen, quantize ? quantized.data() : (const unsigned char *)m_mesh.m_vertices.data(), slen, compressionLevel) != Z_OK)
+         compressFailed = true;
+      bw.WriteInt(quantize ? FID(M3QY) : FID(M3CY), (int)clen);
+      bw.WriteStruct(quantize ? FID(M3QX) : FID(M3CX), c, clen);
       free(c);
       }
 #endif
@@ -1653,8 +1818,8 @@ HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool sav
          const mz_ulong slen = (mz_ulong)(sizeof(unsigned int)*m_mesh.NumIndices());
          mz_ulong clen = compressBound(slen);
          mz_uint8 * c = (mz_uint8 *)malloc(clen);
-         if (compress2(c, &clen, (const unsigned char *)m_mesh.m_indices.data(), slen, MZ_BEST_COMPRESSION) != Z_OK)
-            ShowError("Could not compress primitive index data");
+         if (compress2(c, &clen, (const unsigned char *)m_mesh.m_indices.data(), slen, compressionLevel) != Z_OK)
+            compressFailed = true;
          bw.WriteInt(FID(M3CJ), (int)clen);
          bw.WriteStruct(FID(M3CI), c, clen);
          free(c);
@@ -1674,8 +1839,8 @@ HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool sav
          const mz_ulong slen = (mz_ulong)(sizeof(WORD)*m_mesh.NumIndices());
          mz_ulong clen = compressBound(slen);
          mz_uint8 * c = (mz_uint8 *)malloc(clen);
-         if (compress2(c, &clen, (const unsigned char *)tmp.data(), slen, MZ_BEST_COMPRESSION) != Z_OK)
-            ShowError("Could not compress primitive index data");
+         if (compress2(c, &clen, (const unsigned char *)tmp.data(), slen, compressionLevel) != Z_OK)
+            compressFailed = true;
          bw.WriteInt(FID(M3CJ), (int)clen);
          bw.WriteStruct(FID(M3CI), c, clen);
          free(c);
@@ -1689,8 +1854,8 @@ HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool sav
          {
             mz_ulong clen = compressBound(slen);
             mz_uint8 * c = (mz_uint8 *)malloc(clen);
-            if (compress2(c, &clen, (const unsigned char *)m_mesh.m_animationFrames[i].m_frameVerts.data(), slen, MZ_BEST_COMPRESSION) != Z_OK)
-               ShowError("Could not compress primitive animation vertex data");
+            if (compress2(c, &clen, (const unsigned char *)m_mesh.m_animationFrames[i].m_frameVerts.data(), slen, compressionLevel) != Z_OK)
+               compressFailed = true;
             bw.WriteInt(FID(M3AY), (int)clen);
             bw.WriteStruct(FID(M3AX), c, clen);
             free(c);
@@ -1715,7 +1880,7 @@ HRESULT Primitive::SaveData(IStream *pstm, HCRYPTHASH hcrypthash, const bool sav
 
    bw.WriteTag(FID(ENDB));
 
-   return S_OK;
+   return compressFailed ? E_FAIL : S_OK;
 }
 
 HRESULT Primitive::InitLoad(IStream *pstm, PinTable *ptable, int *pid, int version, HCRYPTHASH hcrypthash, HCRYPTKEY hcryptkey)
@@ -1851,6 +2016,28 @@ bool Primitive::LoadToken(const int id, BiffReader * const pbr)
 	  });
       break;
    }
+   case FID(M3QY): pbr->GetInt(m_compressedVertices); break;
+   case FID(M3QX):
+   {
+      m_mesh.m_vertices.clear();
+      m_mesh.m_vertices.resize(m_numVertices);
+      mz_uint8 * c = (mz_uint8 *)malloc(m_compressedVertices);
+      pbr->GetStruct(c, m_compressedVertices);
+      if (g_pPrimitiveDecompressThreadPool == nullptr)
+         g_pPrimitiveDecompressThreadPool = new ThreadPool(g_pvp->m_logicalNumberOfProcessors);
+
+      g_pPrimitiveDecompressThreadPool->enqueue([c, this] {
+         vector<uint8_t> quantized(GetQuantizedMeshSize(m_mesh.NumVertices()));
+         mz_ulong uclen = (mz_ulong)quantized.size();
+         const int error = uncompress(quantized.data(), &uclen, c, m_compressedVertices);
+         if (error != Z_OK)
+            ShowError("Could not uncompress quantized primitive vertex data, error "+std::to_string(error));
+         else
+            DequantizeMesh(quantized.data(), m_mesh.NumVertices(), m_mesh.m_vertices.data());
+         free(c);
+      });
+      break;
+   }
 #endif
    case FID(M3FN): pbr->GetInt(m_numIndices); break;
    case FID(M3DI):
@@ -9,7 +9,6 @@
 Spinner::Spinner()
 {
    m_phitspinner = nullptr;
-   m_vertexBuffer_spinneranimangle = -FLT_MAX;
 }
 
 Spinner::~Spinner()
@@ -265,23 +264,8 @@ void Spinner::ExportMesh(ObjLoader& loader)
 
       transformedVertices.resize(spinnerBracketNumVertices);
 
-      for (unsigned int i = 0; i < spinnerBracketNumVertices; i++)
-      {
-         Vertex3Ds vert(spinnerBracket[i].x, spinnerBracket[i].y, spinnerBracket[i].z);
-         vert = m_fullMatrix.MultiplyVector(vert);
-         transformedVertices[i].x = vert.x*m_d.m_length + m_d.m_vCenter.x;
-         transformedVertices[i].y = vert.y*m_d.m_length + m_d.m_vCenter.y;
-         transformedVertices[i].z = vert.z*m_d.m_length + m_posZ;
-
-         vert = Vertex3Ds(spinnerBracket[i].nx, spinnerBracket[i].ny, spinnerBracket[i].nz);
-         vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-         transformedVertices[i].nx = vert.x;
-         transformedVertices[i].ny = vert.y;
-         transformedVertices[i].nz = vert.z;
-
-         transformedVertices[i].tu = spinnerBracket[i].tu;
-         transformedVertices[i].tv = spinnerBracket[i].tv;
-      }
+      const Matrix3D vertMatrix = m_fullMatrix * Matrix3D::MatrixScale(m_d.m_length) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_posZ);
+      vertMatrix.TransformVertices(spinnerBracket, transformedVertices.data(), spinnerBracketNumVertices, m_fullMatrix);
       loader.WriteVertexInfo(transformedVertices.data(), spinnerBracketNumVertices);
 
       const Material * const mat = m_ptable->GetMaterial(m_d.m_szMaterial);
@@ -294,7 +278,6 @@ void Spinner::ExportMesh(ObjLoader& loader)
    }
 
    transformedVertices.resize(spinnerPlateNumVertices);
-   m_vertexBuffer_spinneranimangle = -FLT_MAX;
    UpdatePlate(transformedVertices.data());
 
    const string subObjName = name + "Plate"s;
@@ -324,31 +307,27 @@ void Spinner::RenderSetup(RenderDevice *device)
 
    Vertex3D_NoTex2 *buf;
    bracketVertexBuffer->lock(0, 0, (void **)&buf, VertexBuffer::WRITEONLY);
-   for (unsigned int i = 0; i < spinnerBracketNumVertices; i++)
-   {
-      Vertex3Ds vert(spinnerBracket[i].x, spinnerBracket[i].y, spinnerBracket[i].z);
-      vert = m_fullMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*m_d.m_length + m_d.m_vCenter.x;
-      buf[i].y = vert.y*m_d.m_length + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_length + m_posZ;
-
-      vert = Vertex3Ds(spinnerBracket[i].nx, spinnerBracket[i].ny, spinnerBracket[i].nz);
-      vert = m_fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
-
-      buf[i].tu = spinnerBracket[i].tu;
-      buf[i].tv = spinnerBracket[i].tv;
-   }
+   const Matrix3D vertMatrix = m_fullMatrix * Matrix3D::MatrixScale(m_d.m_length) * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_posZ);
+   vertMatrix.TransformVertices(spinnerBracket, buf, spinnerBracketNumVertices, m_fullMatrix);
    bracketVertexBuffer->unlock();
 
    IndexBuffer* plateIndexBuffer = new IndexBuffer(m_rd, spinnerPlateNumFaces, spinnerPlateIndices);
-   VertexBuffer* plateVertexBuffer = new VertexBuffer(m_rd, spinnerPlateNumVertices, nullptr, true);
+   VertexBuffer* plateVertexBuffer = new VertexBuffer(m_rd, spinnerPlateNumVertices);
+   // The plate mesh is static, in its local space (see GetPlateTransform), its rotation is applied through the world matrix
+   plateVertexBuffer->lock(0, 0, (void **)&buf, VertexBuffer::WRITEONLY);
+   for (unsigned int i = 0; i < spinnerPlateNumVertices; i++)
+   {
+      buf[i].x = spinnerPlate[i].x*m_d.m_length;
+      buf[i].y = spinnerPlate[i].y*m_d.m_length;
+      buf[i].z = spinnerPlate[i].z*m_d.m_length;
+      buf[i].nx = spinnerPlate[i].nx;
+      buf[i].ny = spinnerPlate[i].ny;
+      buf[i].nz = spinnerPlate[i].nz;
+      buf[i].tu = spinnerPlate[i].tu;
+      buf[i].tv = spinnerPlate[i].tv;
+   }
+   plateVertexBuffer->unlock();
    m_plateMeshBuffer = new MeshBuffer(m_wzName + L".Plate"s, plateVertexBuffer, plateIndexBuffer, true);
-
-   m_vertexBuffer_spinneranimangle = -FLT_MAX;
-   UpdatePlate(nullptr);
 }
 
 void Spinner::RenderRelease()
@@ -406,55 +385,28 @@ void Spinner::Render(const unsigned int renderMask)
 
    if (m_phitspinner->m_spinnerMover.m_visible && !isStaticOnly)
    {
-      UpdatePlate(nullptr);
+      g_pplayer->UpdateBasicShaderMatrix(GetPlateTransform());
       Vertex3Ds pos(m_d.m_vCenter.x, m_d.m_vCenter.y, m_posZ);
       m_rd->basicShader->SetBasic(m_ptable->GetMaterial(m_d.m_szMaterial), m_ptable->GetImage(m_d.m_szImage));
       m_rd->DrawMesh(m_rd->basicShader, false, pos, 0.f, m_plateMeshBuffer, RenderDevice::TRIANGLELIST, 0, spinnerPlateNumFaces);
+      g_pplayer->UpdateBasicShaderMatrix();
    }
 }
 
-void Spinner::UpdatePlate(Vertex3D_NoTex2 * const vertBuffer)
+// Transform of the plate from its local space (scaled by the spinner length) to world space
+Matrix3D Spinner::GetPlateTransform() const
 {
-   // early out in case still same rotation
-   if (m_phitspinner->m_spinnerMover.m_angle == m_vertexBuffer_spinneranimangle)
-       return;
-
-   m_vertexBuffer_spinneranimangle = m_phitspinner->m_spinnerMover.m_angle;
-
-   Matrix3D fullMatrix;
-   Matrix3D rotzMat, rotxMat;
-
-   fullMatrix.SetIdentity();
+   Matrix3D rotxMat, rotzMat;
    rotxMat.SetRotateX(-m_phitspinner->m_spinnerMover.m_angle);
-   rotxMat.Multiply(fullMatrix, fullMatrix);
    rotzMat.SetRotateZ(ANGTORAD(m_d.m_rotation));
-   rotzMat.Multiply(fullMatrix, fullMatrix);
-
-   Vertex3D_NoTex2 *buf;
-   if (vertBuffer == nullptr)
-      m_plateMeshBuffer->m_vb->lock(0, 0, (void**)&buf, VertexBuffer::DISCARDCONTENTS);
-   else
-      buf = vertBuffer;
-
-   for (unsigned int i = 0; i < spinnerPlateNumVertices; i++)
-   {
-      Vertex3Ds vert(spinnerPlate[i].x, spinnerPlate[i].y, spinnerPlate[i].z);
-      vert = fullMatrix.MultiplyVector(vert);
-      buf[i].x = vert.x*m_d.m_length + m_d.m_vCenter.x;
-      buf[i].y = vert.y*m_d.m_length + m_d.m_vCenter.y;
-      buf[i].z = vert.z*m_d.m_length + m_posZ;
-
-      vert = Vertex3Ds(spinnerPlate[i].nx, spinnerPlate[i].ny, spinnerPlate[i].nz);
-      vert = fullMatrix.MultiplyVectorNoTranslate(vert);
-      buf[i].nx = vert.x;
-      buf[i].ny = vert.y;
-      buf[i].nz = vert.z;
+   return rotxMat * rotzMat * Matrix3D::MatrixTranslate(m_d.m_vCenter.x, m_d.m_vCenter.y, m_posZ);
+}
 
-      buf[i].tu = spinnerPlate[i].tu;
-      buf[i].tv = spinnerPlate[i].tv;
-   }
-   if (vertBuffer == nullptr)
-      m_plateMeshBuffer->m_vb->unlock();
+void Spinner::UpdatePlate(Vertex3D_NoTex2 * const buf) const
+{
+   const Matrix3D fullMatrix = GetPlateTransform();
+   const Matrix3D vertMatrix = Matrix3D::MatrixScale(m_d.m_length) * fullMatrix;
+   vertMatrix.TransformVertices(spinnerPlate, buf, spinnerPlateNumVertices, fullMatrix);
 }
 
 #pragma endregion
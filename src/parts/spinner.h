@@ -91,7 +91,8 @@ public:
    SpinnerData m_d;
 
 private:
-   void UpdatePlate(Vertex3D_NoTex2 * const vertBuffer);
+   Matrix3D GetPlateTransform() const;
+   void UpdatePlate(Vertex3D_NoTex2 * const buf) const; // Compute the world space plate mesh (for export)
 
    PinTable *m_ptable;
 
@@ -105,8 +106,6 @@ private:
    HitSpinner *m_phitspinner;
    float m_lastAngle;
 
-   float m_vertexBuffer_spinneranimangle;
-
    // ISpinner
 public:
    STDMETHOD(get_Surface)(/*[out, retval]*/ BSTR *pVal);
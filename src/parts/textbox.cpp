@@ -243,7 +243,7 @@ bool Textbox::LoadToken(const int id, BiffReader * const pbr)
 
 HRESULT Textbox::InitPostLoad()
 {
-   m_texture = nullptr;
+   m_glyphAtlas = nullptr;
 
    return S_OK;
 }
@@ -393,20 +393,292 @@ void Textbox::RenderSetup(RenderDevice *device)
    const int height = (int)max(m_d.m_v1.y, m_d.m_v2.y) - (int)min(m_d.m_v1.y, m_d.m_v2.y);
    if (width > 0 && height > 0)
    {
-      m_texture = new BaseTexture(width, height, BaseTexture::SRGBA);
-      m_textureDirty = true;
+      m_glyphAtlas = AcquireGlyphAtlas(m_pIFontPlay);
+      m_textDirty = true;
    }
 }
 
 void Textbox::RenderRelease()
 {
    assert(m_rd != nullptr);
-   delete m_texture;
-   m_texture = nullptr;
+   if (m_glyphAtlas)
+      ReleaseGlyphAtlas(m_glyphAtlas);
+   m_glyphAtlas = nullptr;
+   delete m_textMeshBuffer;
+   m_textMeshBuffer = nullptr;
+   m_textQuadCount = 0;
    SAFE_RELEASE(m_pIFontPlay);
    m_rd = nullptr;
 }
 
+struct Textbox::GlyphAtlas
+{
+   struct Glyph
+   {
+      float u0, v0, u1, v1; // Texture coordinates of the glyph quad in the atlas
+      int offset; // Horizontal offset of the glyph quad from the pen position
+      int width; // Width of the glyph quad (0 if nothing to draw)
+      int advance; // Pen advance
+   };
+   string key;
+   Glyph glyphs[256];
+   int glyphHeight; // Height of all glyph quads
+   int lineHeight;
+   BaseTexture *texture; // White glyphs, with their coverage as alpha
+   unsigned int refCount;
+
+   static robin_hood::unordered_map<string, GlyphAtlas *> m_atlases; // Atlases in use, by font description
+};
+
+robin_hood::unordered_map<string, Textbox::GlyphAtlas *> Textbox::GlyphAtlas::m_atlases;
+
+static float InvsRGB(const float x)
+{
+   return (x <= 0.04045f) ? (x * (float)(1.0 / 12.92)) : powf(x * (float)(1.0 / 1.055) + (float)(0.055 / 1.055), 2.4f);
+}
+
+Textbox::GlyphAtlas *Textbox::AcquireGlyphAtlas(IFont *font)
+{
+   HFONT hFont;
+   font->get_hFont(&hFont);
+
+   // Rasterize with grayscale antialiasing since the glyph coverage is used as the alpha channel
+   LOGFONT lf;
+   GetObject(hFont, sizeof(LOGFONT), &lf);
+   lf.lfQuality = ANTIALIASED_QUALITY;
+
+   const string key = string(lf.lfFaceName) + '/' + std::to_string(lf.lfHeight) + '/' + std::to_string(lf.lfWidth) + '/' + std::to_string(lf.lfWeight) + '/'
+      + std::to_string(lf.lfItalic) + std::to_string(lf.lfUnderline) + std::to_string(lf.lfStrikeOut) + '/' + std::to_string(lf.lfCharSet);
+   const auto it = GlyphAtlas::m_atlases.find(key);
+   if (it != GlyphAtlas::m_atlases.end())
+   {
+      it->second->refCount++;
+      return it->second;
+   }
+
+   GlyphAtlas *const atlas = new GlyphAtlas();
+   atlas->key = key;
+   atlas->refCount = 1;
+   GlyphAtlas::m_atlases[key] = atlas;
+
+   const HFONT hFontAA = CreateFontIndirect(&lf);
+   const HDC hdc = CreateCompatibleDC(nullptr);
+   const HFONT oldFont = (HFONT)SelectObject(hdc, hFontAA);
+
+   TEXTMETRIC tm;
+   GetTextMetrics(hdc, &tm);
+   ABC abc[256];
+   if (!GetCharABCWidths(hdc, 0, 255, abc)) // Not a TrueType font
+   {
+      INT widths[256];
+      GetCharWidth32(hdc, 0, 255, widths);
+      for (int i = 0; i < 256; i++)
+      {
+         abc[i].abcA = 0;
+         abc[i].abcB = widths[i];
+         abc[i].abcC = 0;
+      }
+   }
+
+   // Characters 32..255 are laid out on a 16x14 grid, with a 1 pixel padding to avoid bleeding between glyphs when filtering
+   constexpr int pad = 1;
+   int cellWidth = 1;
+   for (int i = 32; i < 256; i++)
+      cellWidth = max(cellWidth, (int)abc[i].abcB);
+   cellWidth += 2 * pad;
+   const int cellHeight = tm.tmHeight + 2 * pad;
+   const int atlasWidth = 16 * cellWidth;
+   const int atlasHeight = 14 * cellHeight;
+   atlas->glyphHeight = cellHeight;
+   atlas->lineHeight = tm.tmHeight;
+
+   BITMAPINFO bmi = {};
+   bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+   bmi.bmiHeader.biWidth = atlasWidth;
+   bmi.bmiHeader.biHeight = -atlasHeight;
+   bmi.bmiHeader.biPlanes = 1;
+   bmi.bmiHeader.biBitCount = 32;
+   bmi.bmiHeader.biCompression = BI_RGB;
+   bmi.bmiHeader.biSizeImage = 0;
+
+   void *bits;
+   const HBITMAP hbm = CreateDIBSection(0, &bmi, DIB_RGB_COLORS, &bits, nullptr, 0);
+   assert(hbm);
+   const HBITMAP oldBmp = (HBITMAP)SelectObject(hdc, hbm);
+   PatBlt(hdc, 0, 0, atlasWidth, atlasHeight, BLACKNESS);
+   SetTextColor(hdc, RGB(255, 255, 255));
+   SetBkMode(hdc, TRANSPARENT);
+   SetTextAlign(hdc, TA_LEFT | TA_TOP | TA_NOUPDATECP);
+
+   memset(atlas->glyphs, 0, sizeof(atlas->glyphs));
+   for (int i = 32; i < 256; i++)
+   {
+      GlyphAtlas::Glyph &glyph = atlas->glyphs[i];
+      glyph.advance = abc[i].abcA + (int)abc[i].abcB + abc[i].abcC;
+      if (i == ' ')
+         continue;
+      const int cellX = ((i - 32) & 15) * cellWidth;
+      const int cellY = ((i - 32) >> 4) * cellHeight;
+      const char c = (char)i;
+      TextOut(hdc, cellX + pad - abc[i].abcA, cellY + pad, &c, 1);
+      glyph.offset = abc[i].abcA - pad;
+      glyph.width = (int)abc[i].abcB + 2 * pad;
+      glyph.u0 = (float)cellX / (float)atlasWidth;
+      glyph.v0 = (float)cellY / (float)atlasHeight;
+      glyph.u1 = (float)(cellX + glyph.width) / (float)atlasWidth;
+      glyph.v1 = (float)(cellY + cellHeight) / (float)atlasHeight;
+   }
+   GdiFlush(); // make sure everything is drawn
+
+   // Glyphs are stored in white with their coverage as alpha, the font color is applied when rendering
+   atlas->texture = new BaseTexture(atlasWidth, atlasHeight, BaseTexture::SRGBA);
+   const D3DCOLOR *__restrict bitsd = (D3DCOLOR *)bits;
+   D3DCOLOR *__restrict dest = (D3DCOLOR *)atlas->texture->data();
+   for (unsigned int i = 0; i < atlas->texture->height(); i++)
+   {
+      for (unsigned int l = 0; l < atlas->texture->width(); l++, dest++, bitsd++)
+         *dest = ((*bitsd & 0x0000FF00u) << 16) | 0x00FFFFFFu;
+      dest += atlas->texture->pitch() / 4 - atlas->texture->width();
+   }
+
+   SelectObject(hdc, oldFont);
+   SelectObject(hdc, oldBmp);
+   DeleteDC(hdc);
+   DeleteObject(hbm);
+   DeleteObject(hFontAA);
+   return atlas;
+}
+
+void Textbox::ReleaseGlyphAtlas(GlyphAtlas *atlas)
+{
+   atlas->refCount--;
+   if (atlas->refCount == 0)
+   {
+      GlyphAtlas::m_atlases.erase(atlas->key);
+      delete atlas->texture;
+      delete atlas;
+   }
+}
+
+// Layout the text (word wrapped, like GDI DrawText) and update the glyph quads, the texture is not modified
+void Textbox::UpdateTextMesh(const float x, const float y, const float w, const float h)
+{
+   const int width = (int)max(m_d.m_v1.x, m_d.m_v2.x) - (int)min(m_d.m_v1.x, m_d.m_v2.x);
+   const int height = (int)max(m_d.m_v1.y, m_d.m_v2.y) - (int)min(m_d.m_v1.y, m_d.m_v2.y);
+   m_textQuadCount = 0;
+   if (width <= 0 || height <= 0)
+      return;
+   const int border = (4 * g_pplayer->m_wnd_width) / EDITOR_BG_WIDTH;
+   const int left = border;
+   const int right = width - border * 2;
+
+   const string &text = m_d.m_sztext;
+   const GlyphAtlas::Glyph *const glyphs = m_glyphAtlas->glyphs;
+   const auto measure = [glyphs, &text](size_t start, size_t end)
+   {
+      while (end > start && text[end - 1] == ' ') // Trailing spaces are not part of the line
+         end--;
+      int lineWidth = 0;
+      for (size_t i = start; i < end; i++)
+         lineWidth += glyphs[(unsigned char)text[i]].advance;
+      return lineWidth;
+   };
+
+   // Split in lines, on line feeds, and between words when a line would exceed the layout width
+   vector<std::pair<size_t, size_t>> lines;
+   size_t pos = 0;
+   while (true)
+   {
+      size_t end = text.find('\n', pos);
+      const bool lastLine = end == string::npos;
+      if (lastLine)
+         end = text.length();
+      const size_t paraEnd = (end > pos && text[end - 1] == '\r') ? end - 1 : end;
+      size_t lineStart = pos, lastSpace = string::npos;
+      int lineWidth = 0;
+      for (size_t i = pos; i < paraEnd; i++)
+      {
+         if (text[i] == ' ')
+            lastSpace = i;
+         lineWidth += glyphs[(unsigned char)text[i]].advance;
+         if (lineWidth > right - left && text[i] != ' ' && lastSpace != string::npos)
+         {
+            lines.emplace_back(lineStart, lastSpace);
+            lineStart = lastSpace + 1;
+            lastSpace = string::npos;
+            lineWidth = measure(lineStart, i + 1);
+         }
+      }
+      lines.emplace_back(lineStart, paraEnd);
+      if (lastLine)
+         break;
+      pos = end + 1;
+   }
+
+   vector<Vertex3D_NoTex2> vertices;
+   vertices.reserve(text.length() * 4);
+   const float sx = w / (float)width, sy = h / (float)height;
+   for (size_t l = 0; l < lines.size(); l++)
+   {
+      const int lineWidth = measure(lines[l].first, lines[l].second);
+      int penX;
+      switch (m_d.m_talign)
+      {
+      case TextAlignLeft: penX = left; break;
+
+      default:
+      case TextAlignCenter: penX = left + (right - left - lineWidth) / 2; break;
+
+      case TextAlignRight: penX = right - lineWidth; break;
+      }
+      const float y0 = y + (float)(border + (int)l * m_glyphAtlas->lineHeight - (m_glyphAtlas->glyphHeight - m_glyphAtlas->lineHeight) / 2) * sy;
+      const float y1 = y0 + (float)m_glyphAtlas->glyphHeight * sy;
+      for (size_t i = lines[l].first; i < lines[l].second; i++)
+      {
+         const GlyphAtlas::Glyph &glyph = glyphs[(unsigned char)text[i]];
+         if (glyph.width > 0)
+         {
+            const float x0 = x + (float)(penX + glyph.offset) * sx;
+            const float x1 = x0 + (float)glyph.width * sx;
+            vertices.push_back({ x0 * 2.0f - 1.0f, 1.0f - y0 * 2.0f, 0.f, 0.f, 0.f, 1.f, glyph.u0, glyph.v0 });
+            vertices.push_back({ x1 * 2.0f - 1.0f, 1.0f - y0 * 2.0f, 0.f, 0.f, 0.f, 1.f, glyph.u1, glyph.v0 });
+            vertices.push_back({ x0 * 2.0f - 1.0f, 1.0f - y1 * 2.0f, 0.f, 0.f, 0.f, 1.f, glyph.u0, glyph.v1 });
+            vertices.push_back({ x1 * 2.0f - 1.0f, 1.0f - y1 * 2.0f, 0.f, 0.f, 0.f, 1.f, glyph.u1, glyph.v1 });
+         }
+         penX += glyph.advance;
+      }
+   }
+
+   m_textQuadCount = min((unsigned int)(vertices.size() / 4), 65536u / 4u); // 16 bit indices
+   if (m_textQuadCount == 0)
+      return;
+
+   // (Re)create the mesh buffer when the text outgrows it
+   if (m_textMeshBuffer == nullptr || m_textMeshBuffer->m_vb->m_count < m_textQuadCount * 4)
+   {
+      delete m_textMeshBuffer;
+      const unsigned int maxQuads = min(max(64u, m_textQuadCount * 2u), 65536u / 4u);
+      vector<WORD> indices(maxQuads * 6);
+      for (unsigned int i = 0; i < maxQuads; i++)
+      {
+         indices[i * 6 + 0] = i * 4 + 0;
+         indices[i * 6 + 1] = i * 4 + 1;
+         indices[i * 6 + 2] = i * 4 + 2;
+         indices[i * 6 + 3] = i * 4 + 2;
+         indices[i * 6 + 4] = i * 4 + 1;
+         indices[i * 6 + 5] = i * 4 + 3;
+      }
+      VertexBuffer *vb = new VertexBuffer(m_rd, maxQuads * 4, nullptr, true);
+      IndexBuffer *ib = new IndexBuffer(m_rd, indices);
+      m_textMeshBuffer = new MeshBuffer(m_wzName + L".Text"s, vb, ib, true);
+   }
+
+   Vertex3D_NoTex2 *buf;
+   m_textMeshBuffer->m_vb->lock(0, m_textQuadCount * 4 * sizeof(Vertex3D_NoTex2), (void **)&buf, VertexBuffer::DISCARDCONTENTS);
+   memcpy(buf, vertices.data(), m_textQuadCount * 4 * sizeof(Vertex3D_NoTex2));
+   m_textMeshBuffer->m_vb->unlock();
+}
+
 void Textbox::UpdateAnimation(const float diff_time_msec)
 {
    assert(m_rd != nullptr);
@@ -424,7 +696,7 @@ void Textbox::Render(const unsigned int renderMask)
    if (isStaticOnly
       || !m_d.m_visible
       || (m_backglass && isReflectionPass)
-      || (!dmd && m_texture == nullptr)
+      || (!dmd && m_glyphAtlas == nullptr)
       || (dmd && g_pplayer->m_texdmd == nullptr))
       return;
 
@@ -487,100 +759,38 @@ void Textbox::Render(const unsigned int renderMask)
       m_rd->GetCurrentPass()->m_commands.back()->SetTransparent(true);
       m_rd->GetCurrentPass()->m_commands.back()->SetDepth(-10000.f);
    }
-   else if (m_texture)
+   else if (m_glyphAtlas)
    {
-      if (m_textureDirty)
+      const vec4 textRect(x, y, w, h);
+      if (m_textDirty || m_textAlign != m_d.m_talign || memcmp(&textRect, &m_textRect, sizeof(vec4)) != 0)
       {
-         m_textureDirty = false;
-
-         RECT rect;
-         rect.left = (int)min(m_d.m_v1.x, m_d.m_v2.x);
-         rect.top = (int)min(m_d.m_v1.y, m_d.m_v2.y);
-         rect.right = (int)max(m_d.m_v1.x, m_d.m_v2.x);
-         rect.bottom = (int)max(m_d.m_v1.y, m_d.m_v2.y);
-
-         const int width = rect.right - rect.left;
-         const int height = rect.bottom - rect.top;
-
-         BITMAPINFO bmi = {};
-         bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-         bmi.bmiHeader.biWidth = width;
-         bmi.bmiHeader.biHeight = -height;
-         bmi.bmiHeader.biPlanes = 1;
-         bmi.bmiHeader.biBitCount = 32;
-         bmi.bmiHeader.biCompression = BI_RGB;
-         bmi.bmiHeader.biSizeImage = 0;
-
-         void *bits;
-         const HBITMAP hbm = CreateDIBSection(0, &bmi, DIB_RGB_COLORS, &bits, nullptr, 0);
-         assert(hbm);
-
-         const HDC hdc = CreateCompatibleDC(nullptr);
-         const HBITMAP oldBmp = (HBITMAP)SelectObject(hdc, hbm);
-
-         const HBRUSH hbrush = CreateSolidBrush(m_d.m_backcolor);
-         const HBRUSH hbrushold = (HBRUSH)SelectObject(hdc, hbrush);
-         PatBlt(hdc, 0, 0, width, height, PATCOPY);
-         SelectObject(hdc, hbrushold);
-         DeleteObject(hbrush);
-
-         HFONT hFont;
-         m_pIFontPlay->get_hFont(&hFont);
-         const HFONT oldFont = (HFONT)SelectObject(hdc, hFont);
-         SetTextColor(hdc, m_d.m_fontcolor);
-         SetBkMode(hdc, TRANSPARENT);
-         SetTextAlign(hdc, TA_LEFT | TA_TOP | TA_NOUPDATECP);
-
-         int alignment;
-         switch (m_d.m_talign)
-         {
-         case TextAlignLeft: alignment = DT_LEFT; break;
-
-         default:
-         case TextAlignCenter: alignment = DT_CENTER; break;
-
-         case TextAlignRight: alignment = DT_RIGHT; break;
-         }
-
-         const int border = (4 * g_pplayer->m_wnd_width) / EDITOR_BG_WIDTH;
-         RECT rcOut;
-         rcOut.left = border;
-         rcOut.top = border;
-         rcOut.right = width - border * 2;
-         rcOut.bottom = height - border * 2;
-
-         DrawText(hdc, m_d.m_sztext.c_str(), (int)m_d.m_sztext.length(), &rcOut, alignment | DT_NOCLIP | DT_NOPREFIX | DT_WORDBREAK);
-
-         GdiFlush(); // make sure everything is drawn
-
-         // Set alpha for pixels that match transparent color (if transparent enabled), otherwise set to opaque
-         const D3DCOLOR *__restrict bitsd = (D3DCOLOR *)bits;
-         D3DCOLOR *__restrict dest = (D3DCOLOR *)m_texture->data();
-         for (unsigned int i = 0; i < m_texture->height(); i++)
-         {
-            for (unsigned int l = 0; l < m_texture->width(); l++, dest++, bitsd++)
-            {
-               const D3DCOLOR src = *bitsd;
-               if (m_d.m_transparent && ((src & 0xFFFFFFu) == m_d.m_backcolor))
-                  *dest = 0x00000000; // set to black & alpha full transparent
-               else
-                  *dest = ((src & 0x000000FFu) << 16) | (src & 0x0000FF00u) | ((src & 0x0000FF0000u) >> 16) | 0xFF000000u;
-            }
-            dest += m_texture->pitch() / 4 - m_texture->width();
-         }
-
-         m_rd->m_texMan.SetDirty(m_texture);
-
-         SelectObject(hdc, oldFont);
-         SelectObject(hdc, oldBmp);
-         DeleteDC(hdc);
-         DeleteObject(hbm);
+         m_textDirty = false;
+         m_textRect = textRect;
+         m_textAlign = m_d.m_talign;
+         UpdateTextMesh(x, y, w, h);
       }
 
       m_rd->ResetRenderState();
-      m_rd->DMDShader->SetFloat(SHADER_alphaTestValue, (float)(128.0 / 255.0));
-      g_pplayer->Spritedraw(x, y, w, h, 0xFFFFFFFF, m_rd->m_texMan.LoadTexture(m_texture, SF_TRILINEAR, SA_REPEAT, SA_REPEAT, false), m_d.m_intensity_scale);
-      m_rd->DMDShader->SetFloat(SHADER_alphaTestValue, 1.0f);
+      if (!m_d.m_transparent)
+         g_pplayer->Spritedraw(x, y, w, h, m_d.m_backcolor, (Texture *)nullptr, m_d.m_intensity_scale);
+
+      if (m_textQuadCount > 0)
+      {
+         m_rd->ResetRenderState();
+         m_rd->SetRenderState(RenderState::ZENABLE, RenderState::RS_FALSE);
+         m_rd->SetRenderState(RenderState::ALPHABLENDENABLE, RenderState::RS_TRUE);
+         m_rd->SetRenderState(RenderState::SRCBLEND, RenderState::SRC_ALPHA);
+         m_rd->SetRenderState(RenderState::DESTBLEND, RenderState::INVSRC_ALPHA);
+         m_rd->DMDShader->SetTechnique(SHADER_TECHNIQUE_basic_noDMD);
+         // The atlas is sRGB encoded, so the font color is converted to linear to match the former colored glyph texture
+         const vec4 fc = convertColor(m_d.m_fontcolor, m_d.m_intensity_scale);
+         const vec4 c(InvsRGB(fc.x), InvsRGB(fc.y), InvsRGB(fc.z), fc.w);
+         m_rd->DMDShader->SetVector(SHADER_vColor_Intensity, &c);
+         m_rd->DMDShader->SetTexture(SHADER_tex_sprite, m_glyphAtlas->texture, SF_BILINEAR, SA_CLAMP, SA_CLAMP);
+         m_rd->DMDShader->SetFloat(SHADER_alphaTestValue, (float)(1.0 / 255.0));
+         m_rd->DrawMesh(m_rd->DMDShader, true, Vertex3Ds(0.f, 0.f, 0.f), -10000.f, m_textMeshBuffer, RenderDevice::TRIANGLELIST, 0, m_textQuadCount * 6);
+         m_rd->DMDShader->SetFloat(SHADER_alphaTestValue, 1.0f);
+      }
    }
 }
 
@@ -631,7 +841,7 @@ STDMETHODIMP Textbox::put_Text(BSTR newVal)
    char buf[MAXSTRING];
    WideCharToMultiByteNull(CP_ACP, 0, newVal, -1, buf, MAXSTRING, nullptr, nullptr);
    m_d.m_sztext = buf;
-   m_textureDirty = true;
+   m_textDirty = true;
 
    return S_OK;
 }
@@ -746,6 +956,7 @@ STDMETHODIMP Textbox::get_Alignment(TextAlignment *pVal)
 STDMETHODIMP Textbox::put_Alignment(TextAlignment newVal)
 {
    m_d.m_talign = newVal;
+   m_textDirty = true;
 
    return S_OK;
 }
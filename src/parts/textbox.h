@@ -87,10 +87,21 @@ private:
    PinTable *m_ptable = nullptr;
    
    RenderDevice *m_rd = nullptr;
-   bool m_textureDirty = true;
-   BaseTexture *m_texture = nullptr;
    IFont *m_pIFontPlay = nullptr; // Our font, scaled to match play window resolution
 
+   // The play font is rasterized once in a glyph atlas, shared by all textboxes using the same font and size,
+   // then the text is rendered as a batch of textured quads (one per glyph) tinted with the font color
+   struct GlyphAtlas;
+   static GlyphAtlas *AcquireGlyphAtlas(IFont *font);
+   static void ReleaseGlyphAtlas(GlyphAtlas *atlas);
+   void UpdateTextMesh(const float x, const float y, const float w, const float h);
+   GlyphAtlas *m_glyphAtlas = nullptr;
+   MeshBuffer *m_textMeshBuffer = nullptr;
+   unsigned int m_textQuadCount = 0;
+   bool m_textDirty = true;
+   vec4 m_textRect; // Rectangle used to layout the text mesh, to detect changes
+   TextAlignment m_textAlign = TextAlignLeft; // Alignment used to layout the text mesh, to detect changes
+
 public:
    // ITextbox
    STDMETHOD(get_IsTransparent)(/*[out, retval]*/ VARIANT_BOOL *pVal);
@@ -168,28 +168,13 @@ STDMETHODIMP Timer::put_Enabled(VARIANT_BOOL newVal)
 
    if (val != m_d.m_tdr.m_TimerEnabled && m_phittimer)
    {
-       // to avoid problems with timers dis/enabling themselves, store all the changes in a list
-       bool found = false;
-       for (size_t i = 0; i < g_pplayer->m_changed_vht.size(); ++i)
-           if (g_pplayer->m_changed_vht[i].m_timer == m_phittimer)
-           {
-               g_pplayer->m_changed_vht[i].m_enabled = val;
-               found = true;
-               break;
-           }
-
-       if (!found)
-       {
-         TimerOnOff too;
-         too.m_enabled = val;
-         too.m_timer = m_phittimer;
-         g_pplayer->m_changed_vht.push_back(too);
-       }
-
        if (val)
+       {
            m_phittimer->m_nextfire = g_pplayer->m_time_msec + m_phittimer->m_interval;
+           g_pplayer->m_timers.Schedule(m_phittimer);
+       }
        else
-           m_phittimer->m_nextfire = 0xFFFFFFFF; // fakes the disabling of the timer, until it will be catched by the cleanup via m_changed_vht
+           g_pplayer->m_timers.Disable(m_phittimer);
    }
 
    m_d.m_tdr.m_TimerEnabled = val;
@@ -216,6 +201,8 @@ STDMETHODIMP Timer::put_Interval(long newVal)
    {
       m_phittimer->m_interval = m_d.m_tdr.m_TimerInterval >= 0 ? max(m_d.m_tdr.m_TimerInterval, MAX_TIMER_MSEC_INTERVAL) : max(-2l, newVal);
       m_phittimer->m_nextfire = g_pplayer->m_time_msec + m_phittimer->m_interval;
+      if (m_phittimer->m_enabled)
+         g_pplayer->m_timers.Schedule(m_phittimer);
    }
 
    STOPUNDO
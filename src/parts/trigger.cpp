@@ -16,7 +16,6 @@ Trigger::Trigger()
    m_doAnimation = false;
    m_moveDown = false;
    m_animHeightOffset = 0.0f;
-   m_vertexBuffer_animHeightOffset = -FLT_MAX;
 
    m_hitEnabled = true;
    m_menuid = IDR_SURFACEMENU;
@@ -499,7 +498,6 @@ void Trigger::RenderSetup(RenderDevice *device)
    m_doAnimation = false;
    m_moveDown = false;
    m_animHeightOffset = 0.0f;
-   m_vertexBuffer_animHeightOffset = -FLT_MAX;
 
    if (!m_d.m_visible || m_d.m_shape == TriggerNone)
       return;
@@ -553,8 +551,11 @@ void Trigger::RenderSetup(RenderDevice *device)
 
    GenerateMesh();
    IndexBuffer *triggerIndexBuffer = new IndexBuffer(m_rd, m_numIndices, indices);
-   VertexBuffer *vertexBuffer = new VertexBuffer(m_rd, m_numVertices, (float*) m_triggerVertices, true);
+   // The mesh is static, its animation is applied through the world matrix, so the vertices are not needed after upload
+   VertexBuffer *vertexBuffer = new VertexBuffer(m_rd, m_numVertices, (float*) m_triggerVertices);
    m_meshBuffer = new MeshBuffer(m_wzName, vertexBuffer, triggerIndexBuffer, true);
+   delete[] m_triggerVertices;
+   m_triggerVertices = nullptr;
 }
 
 void Trigger::RenderRelease()
@@ -562,9 +563,7 @@ void Trigger::RenderRelease()
    assert(m_rd != nullptr);
    m_rd = nullptr;
    delete m_meshBuffer;
-   delete[] m_triggerVertices;
    m_meshBuffer = nullptr;
-   m_triggerVertices = nullptr;
 }
 
 //
@@ -650,30 +649,16 @@ void Trigger::Render(const unsigned int renderMask)
    || (isReflectionPass && !m_d.m_reflectionEnabled))
       return;
       
-   if (m_animHeightOffset != m_vertexBuffer_animHeightOffset)
-   {
-      m_vertexBuffer_animHeightOffset = m_animHeightOffset;
-      Vertex3D_NoTex2 *buf;
-      m_meshBuffer->m_vb->lock(0, 0, (void **)&buf, VertexBuffer::DISCARDCONTENTS);
-      for (int i = 0; i < m_numVertices; i++)
-      {
-         buf[i].x = m_triggerVertices[i].x;
-         buf[i].y = m_triggerVertices[i].y;
-         buf[i].z = m_triggerVertices[i].z + m_animHeightOffset;
-         buf[i].nx = m_triggerVertices[i].nx;
-         buf[i].ny = m_triggerVertices[i].ny;
-         buf[i].nz = m_triggerVertices[i].nz;
-         buf[i].tu = m_triggerVertices[i].tu;
-         buf[i].tv = m_triggerVertices[i].tv;
-      }
-      m_meshBuffer->m_vb->unlock();
-   }
-
    m_rd->ResetRenderState();
    if (m_d.m_shape == TriggerWireA || m_d.m_shape == TriggerWireB || m_d.m_shape == TriggerWireC || m_d.m_shape == TriggerWireD || m_d.m_shape == TriggerInder)
       m_rd->SetRenderState(RenderState::CULLMODE, RenderState::CULL_NONE);
    m_rd->basicShader->SetBasic(m_ptable->GetMaterial(m_d.m_szMaterial), nullptr);
+   const bool isAnimated = m_animHeightOffset != 0.f;
+   if (isAnimated)
+      g_pplayer->UpdateBasicShaderMatrix(Matrix3D::MatrixTranslate(0.f, 0.f, m_animHeightOffset));
    m_rd->DrawMesh(m_rd->basicShader, false, m_boundingSphereCenter, 0.f, m_meshBuffer, RenderDevice::TRIANGLELIST, 0, m_numIndices);
+   if (isAnimated)
+      g_pplayer->UpdateBasicShaderMatrix();
 }
 
 #pragma endregion
@@ -1248,7 +1233,7 @@ STDMETHODIMP Trigger::BallCntOver(int *pVal)
       {
          Ball * const pball = g_pplayer->m_vball[i];
 
-         if (pball->m_d.m_vpVolObjs && FindIndexOf(*(pball->m_d.m_vpVolObjs), (IFireEvents*)this) >= 0) // cast to IFireEvents necessary, as it is stored like this in HitObject.m_obj
+         if (pball->m_d.m_vpVolObjs && pball->m_d.m_vpVolObjs->Contains((IFireEvents*)this)) // cast to IFireEvents necessary, as it is stored like this in HitObject.m_obj
          {
             g_pplayer->m_pactiveball = pball; // set active ball for scriptor
             ++cnt;
@@ -1271,11 +1256,9 @@ STDMETHODIMP Trigger::DestroyBall(int *pVal)
       {
          Ball * const pball = g_pplayer->m_vball[i];
 
-         int j;
-         if (pball->m_d.m_vpVolObjs && (j = FindIndexOf(*(pball->m_d.m_vpVolObjs), (IFireEvents*)this)) >= 0) // cast to IFireEvents necessary, as it is stored like this in HitObject.m_obj
+         if (pball->m_d.m_vpVolObjs && pball->m_d.m_vpVolObjs->Remove((IFireEvents*)this)) // cast to IFireEvents necessary, as it is stored like this in HitObject.m_obj
          {
             ++cnt;
-            pball->m_d.m_vpVolObjs->erase(pball->m_d.m_vpVolObjs->begin() + j);
             g_pplayer->DestroyBall(pball); // inside trigger volume?
          }
       }
@@ -130,7 +130,6 @@ private:
    PropertyPane *m_propVisual;
 
    float m_animHeightOffset;
-   float m_vertexBuffer_animHeightOffset;
    bool m_hitEvent;
    bool m_unhitEvent;
    bool m_doAnimation;
@@ -108,7 +108,7 @@ float LineSeg::HitTestBasic(const BallS& ball, const float dtime, CollisionEvent
              (!ball.m_vpVolObjs) ||
              // is a trigger, so test:
              (fabsf(bnd) >= ball.m_radius*0.5f) ||          // not too close ... nor too far away
-             (inside != (FindIndexOf(*(ball.m_vpVolObjs), m_obj) < 0))) // ...ball outside and hit set or ball inside and no hit set
+             (inside != ball.m_vpVolObjs->Contains(m_obj))) // ...ball outside and hit set or ball inside and no hit set
          {
               return -1.0f;
          }
@@ -235,7 +235,7 @@ float HitCircle::HitTestBasicRadius(const BallS& ball, const float dtime, Collis
    // Kicker is special.. handle ball stalled on kicker, commonly hit while receding, knocking back into kicker pocket
    if (m_ObjType == eKicker && bnd <= 0.f && bnd >= -radius && a < C_CONTACTVEL*C_CONTACTVEL && ball.m_vpVolObjs)
    {
-      RemoveFromVectorSingle(*(ball.m_vpVolObjs), m_obj); // cause capture
+      ball.m_vpVolObjs->Remove(m_obj); // cause capture
    }
 
    if (rigid && bnd < (float)PHYS_TOUCH)        // positive: contact possible in future ... Negative: objects in contact now
@@ -254,12 +254,12 @@ float HitCircle::HitTestBasicRadius(const BallS& ball, const float dtime, Collis
          hittime = std::max(0.0f, -bnd / bnv);
    }
    else if (m_ObjType >= eTrigger // triggers & kickers
-      && ball.m_vpVolObjs && ((bnd < 0.f) == (FindIndexOf(*(ball.m_vpVolObjs), m_obj) < 0)))
+      && ball.m_vpVolObjs && ((bnd < 0.f) == !ball.m_vpVolObjs->Contains(m_obj)))
    { // here if ... ball inside and no hit set .... or ... ball outside and hit set
 
       if (fabsf(bnd - radius) < 0.05f) // if ball appears in center of trigger, then assumed it was gen'ed there
       {
-         ball.m_vpVolObjs->push_back(m_obj); // special case for trigger overlaying a kicker
+         ball.m_vpVolObjs->Add(m_obj);      // special case for trigger overlaying a kicker
       }                                        // this will add the ball to the trigger space without a Hit
       else
       {
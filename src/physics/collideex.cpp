@@ -571,7 +571,7 @@ float Hit3DPoly::HitTest(const BallS& ball, const float dtime, CollisionEvent& c
             (!ball.m_vpVolObjs) ||                  // temporary ball
             // if trigger, then check:
             (fabsf(bnd) >= ball.m_radius*0.5f) ||   // not too close ... nor too far away
-            (inside != (FindIndexOf(*(ball.m_vpVolObjs), m_obj) < 0))) // ...ball outside and hit set or ball inside and no hit set
+            (inside != ball.m_vpVolObjs->Contains(m_obj))) // ...ball outside and hit set or ball inside and no hit set
             return -1.0f;
 
          hittime = 0;
@@ -682,20 +682,20 @@ void Hit3DPoly::Collide(const CollisionEvent& coll)
    {
       if (!pball->m_d.m_vpVolObjs) return;
 
-      const int i = FindIndexOf(*(pball->m_d.m_vpVolObjs), m_obj); // if -1 then not in objects volume set (i.e not already hit)
+      const bool inside = pball->m_d.m_vpVolObjs->Contains(m_obj); // if false then not in objects volume set (i.e not already hit)
 
-      if ((!coll.m_hitflag) == (i < 0)) // Hit == NotAlreadyHit
+      if ((!coll.m_hitflag) == !inside) // Hit == NotAlreadyHit
       {
          pball->m_d.m_pos += STATICTIME * pball->m_d.m_vel;      //move ball slightly forward
 
-         if (i < 0)
+         if (!inside)
          {
-            pball->m_d.m_vpVolObjs->push_back(m_obj);
+            pball->m_d.m_vpVolObjs->Add(m_obj);
             ((Trigger*)m_obj)->FireGroupEvent(DISPID_HitEvents_Hit);
          }
          else
          {
-            pball->m_d.m_vpVolObjs->erase(pball->m_d.m_vpVolObjs->begin() + i);
+            pball->m_d.m_vpVolObjs->Remove(m_obj);
             ((Trigger*)m_obj)->FireGroupEvent(DISPID_HitEvents_Unhit);
          }
       }
@@ -1063,21 +1063,21 @@ void TriggerLineSeg::Collide(const CollisionEvent& coll)
    if ((m_ObjType != eTrigger) ||
       (!pball->m_d.m_vpVolObjs)) return;
 
-   const int i = FindIndexOf(*(pball->m_d.m_vpVolObjs), m_obj); // if -1 then not in objects volume set (i.e not already hit)
+   const bool inside = pball->m_d.m_vpVolObjs->Contains(m_obj); // if false then not in objects volume set (i.e not already hit)
 
-   if ((!coll.m_hitflag) == (i < 0))                 // Hit == NotAlreadyHit
+   if ((!coll.m_hitflag) == !inside)                 // Hit == NotAlreadyHit
    {
       pball->m_d.m_pos += STATICTIME * pball->m_d.m_vel;     // move ball slightly forward
 
-      if (i < 0)
+      if (!inside)
       {
-         pball->m_d.m_vpVolObjs->push_back(m_obj);
+         pball->m_d.m_vpVolObjs->Add(m_obj);
          ((Trigger*)m_obj)->TriggerAnimationHit();
          ((Trigger*)m_obj)->FireGroupEvent(DISPID_HitEvents_Hit);
       }
       else
       {
-         pball->m_d.m_vpVolObjs->erase(pball->m_d.m_vpVolObjs->begin() + i);
+         pball->m_d.m_vpVolObjs->Remove(m_obj);
          ((Trigger*)m_obj)->TriggerAnimationUnhit();
          ((Trigger*)m_obj)->FireGroupEvent(DISPID_HitEvents_Unhit);
       }
@@ -1097,21 +1097,21 @@ void TriggerHitCircle::Collide(const CollisionEvent& coll)
    if ((m_ObjType < eTrigger) || // triggers and kickers
       (!pball->m_d.m_vpVolObjs)) return;
 
-   const int i = FindIndexOf(*(pball->m_d.m_vpVolObjs), m_obj); // if -1 then not in objects volume set (i.e not already hit)
+   const bool inside = pball->m_d.m_vpVolObjs->Contains(m_obj); // if false then not in objects volume set (i.e not already hit)
 
-   if ((!coll.m_hitflag) == (i < 0))                 // Hit == NotAlreadyHit
+   if ((!coll.m_hitflag) == !inside)                 // Hit == NotAlreadyHit
    {
       pball->m_d.m_pos += STATICTIME * pball->m_d.m_vel;     // move ball slightly forward
 
-      if (i < 0)
+      if (!inside)
       {
-         pball->m_d.m_vpVolObjs->push_back(m_obj);
+         pball->m_d.m_vpVolObjs->Add(m_obj);
          ((Trigger*)m_obj)->TriggerAnimationHit();
          ((Trigger*)m_obj)->FireGroupEvent(DISPID_HitEvents_Hit);
       }
       else
       {
-         pball->m_d.m_vpVolObjs->erase(pball->m_d.m_vpVolObjs->begin() + i);
+         pball->m_d.m_vpVolObjs->Remove(m_obj);
          ((Trigger*)m_obj)->TriggerAnimationUnhit();
          ((Trigger*)m_obj)->FireGroupEvent(DISPID_HitEvents_Unhit);
       }
@@ -61,7 +61,7 @@ void Ball::Init(const float mass)
 #endif
 
    if(!m_d.m_vpVolObjs)
-       m_d.m_vpVolObjs = new vector<IFireEvents*>;
+       m_d.m_vpVolObjs = new BallVolumeSet;
 
    m_color = RGB(255, 255, 255);
 
@@ -14,9 +14,62 @@ public:
    Ball *m_pball;
 };
 
+// Set of the triggers and kickers a ball is inside. A ball is rarely inside more than a few volumes at once,
+// so the set is stored inline, allowing constant time membership test, insertion and removal without any allocation.
+// The order of the objects is not meaningful (removal moves the last object to the freed slot).
+class BallVolumeSet
+{
+public:
+   bool Contains(const IFireEvents * const obj) const
+   {
+      for (unsigned int i = 0; i < m_count; ++i)
+         if (m_objs[i] == obj)
+            return true;
+      return !m_overflow.empty() && FindIndexOf(m_overflow, const_cast<IFireEvents *>(obj)) >= 0;
+   }
+
+   void Add(IFireEvents * const obj)
+   {
+      if (m_count < MAX_INLINE_VOLUMES)
+         m_objs[m_count++] = obj;
+      else
+         m_overflow.push_back(obj); // only for balls inside a huge pile of overlapping volumes
+   }
+
+   // Returns false if the object was not in the set
+   bool Remove(const IFireEvents * const obj)
+   {
+      for (unsigned int i = 0; i < m_count; ++i)
+         if (m_objs[i] == obj)
+         {
+            m_count--;
+            if (!m_overflow.empty())
+            {
+               m_objs[i] = m_overflow.back();
+               m_overflow.pop_back();
+               m_count++;
+            }
+            else
+               m_objs[i] = m_objs[m_count];
+            return true;
+         }
+      const int idx = m_overflow.empty() ? -1 : FindIndexOf(m_overflow, const_cast<IFireEvents *>(obj));
+      if (idx < 0)
+         return false;
+      m_overflow.erase(m_overflow.begin() + idx);
+      return true;
+   }
+
+private:
+   static constexpr unsigned int MAX_INLINE_VOLUMES = 8;
+   unsigned int m_count = 0;
+   IFireEvents *m_objs[MAX_INLINE_VOLUMES];
+   vector<IFireEvents *> m_overflow;
+};
+
 struct BallS
 {
-   vector<IFireEvents*>* m_vpVolObjs; // vector of triggers and kickers we are now inside (stored as IFireEvents* though, as HitObject.m_obj stores it like that!)
+   BallVolumeSet* m_vpVolObjs; // triggers and kickers we are now inside (stored as IFireEvents* though, as HitObject.m_obj stores it like that!)
    Vertex3Ds m_pos;
    Vertex3Ds m_vel; // ball velocity
    float m_radius;
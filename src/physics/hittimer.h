@@ -23,4 +23,164 @@ public:
 
    int m_interval;
    unsigned int m_nextfire = 0;
+
+   // Scheduling state, managed by HitTimerQueue
+   bool m_enabled = false;
+   bool m_listed = false; // enabled as of the last applied changes, keeps its enable order while set
+   bool m_pending = false; // has an enable/disable/reschedule change waiting to be applied
+   bool m_queued = false; // has a live entry in the queue heap
+   bool m_inFrameList = false;
+   unsigned int m_scheduleId = 0;
+   unsigned int m_enableOrder = 0; // timers due during the same update are fired in the order they were enabled
+};
+
+// Schedules the enabled timers:
+// - enabling, disabling or rescheduling a timer is O(1): the change is recorded on the timer and in a pending list, which is applied
+//   at the start of the next update (last change wins). Like the previous linear timer list, a timer disabled then enabled again
+//   before the changes are applied keeps its enable order.
+// - timers with a positive interval are kept in a min-heap ordered by their next fire time, so that idle timers are never scanned.
+//   Unscheduling a timer simply invalidates its heap entry, which is discarded when it reaches the top of the heap.
+//   The due timers are returned in enable order, which is the order the previous linear timer list fired them.
+// - timers with a negative interval (-1: synced to frame, -2: controller sync) are kept in a list, in enable order.
+class HitTimerQueue
+{
+public:
+   void Clear()
+   {
+      m_heap.clear();
+      m_frameTimers.clear();
+      m_changed.clear();
+      m_nLiveEntries = 0;
+      m_enableCounter = 0;
+   }
+
+   // Enable the timer (if needed) and (re)schedule it at its current m_nextfire time
+   void Schedule(HitTimer * const pht)
+   {
+      pht->m_enabled = true;
+      MarkChanged(pht);
+   }
+
+   void Disable(HitTimer * const pht)
+   {
+      pht->m_enabled = false;
+      pht->m_nextfire = 0xFFFFFFFF; // fakes the disabling of the timer for a pending fire loop
+      MarkChanged(pht);
+   }
+
+   // Remove from the queue and append to 'due' all timers with a positive interval that are due at the given time, in enable order.
+   // Must be called outside of the timer fire loops (it applies the pending changes)
+   void PopDueTimers(const unsigned int time, vector<HitTimer*> &due)
+   {
+      ApplyChanges();
+      const size_t first = due.size();
+      while (!m_heap.empty() && m_heap.front().nextfire <= time)
+      {
+         const Entry entry = m_heap.front();
+         std::pop_heap(m_heap.begin(), m_heap.end(), Later);
+         m_heap.pop_back();
+         if (entry.scheduleId == entry.timer->m_scheduleId) // discard stale entries
+         {
+            Unqueue(entry.timer);
+            due.push_back(entry.timer);
+         }
+      }
+      std::sort(due.begin() + first, due.end(), [](const HitTimer *a, const HitTimer *b) { return a->m_enableOrder < b->m_enableOrder; });
+   }
+
+   // List of enabled timers with a negative interval. Must be called outside of the timer fire loops (it applies the pending changes and removes disabled timers)
+   const vector<HitTimer*> &GetFrameTimers()
+   {
+      ApplyChanges();
+      size_t n = 0;
+      for (HitTimer *const pht : m_frameTimers)
+      {
+         if (pht->m_enabled && pht->m_interval < 0)
+            m_frameTimers[n++] = pht;
+         else
+            pht->m_inFrameList = false;
+      }
+      m_frameTimers.resize(n);
+      return m_frameTimers;
+   }
+
+private:
+   struct Entry
+   {
+      unsigned int nextfire;
+      unsigned int scheduleId;
+      HitTimer *timer;
+   };
+
+   static bool Later(const Entry &a, const Entry &b) { return a.nextfire > b.nextfire; }
+
+   void MarkChanged(HitTimer * const pht)
+   {
+      if (!pht->m_pending)
+      {
+         pht->m_pending = true;
+         m_changed.push_back(pht);
+      }
+   }
+
+   void ApplyChanges()
+   {
+      for (HitTimer * const pht : m_changed)
+      {
+         pht->m_pending = false;
+         Unqueue(pht);
+         if (!pht->m_enabled)
+         {
+            pht->m_listed = false;
+            continue;
+         }
+         if (!pht->m_listed)
+         {
+            pht->m_listed = true;
+            pht->m_enableOrder = m_enableCounter++;
+         }
+         if (pht->m_interval >= 0)
+         {
+            if (m_heap.size() > 2 * m_nLiveEntries + 64) // too many stale entries: compact the heap before it grows unbounded
+               Compact();
+            m_heap.push_back({ pht->m_nextfire, pht->m_scheduleId, pht });
+            std::push_heap(m_heap.begin(), m_heap.end(), Later);
+            pht->m_queued = true;
+            m_nLiveEntries++;
+         }
+         else if (!pht->m_inFrameList)
+         {
+            pht->m_inFrameList = true;
+            m_frameTimers.push_back(pht);
+         }
+      }
+      m_changed.clear();
+   }
+
+   // Invalidate the live heap entry of the timer if any (it will be discarded when reaching the top of the heap)
+   void Unqueue(HitTimer * const pht)
+   {
+      pht->m_scheduleId++;
+      if (pht->m_queued)
+      {
+         pht->m_queued = false;
+         m_nLiveEntries--;
+      }
+   }
+
+   void Compact()
+   {
+      size_t n = 0;
+      for (const Entry &entry : m_heap)
+         if (entry.scheduleId == entry.timer->m_scheduleId)
+            m_heap[n++] = entry;
+      m_heap.resize(n);
+      std::make_heap(m_heap.begin(), m_heap.end(), Later);
+   }
+
+   vector<Entry> m_heap;
+   size_t m_nLiveEntries = 0;
+   unsigned int m_enableCounter = 0;
+   vector<HitTimer*> m_frameTimers;
+   vector<HitTimer*> m_changed; // timers with a pending change, in the order they were first changed
 };
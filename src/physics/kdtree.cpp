@@ -675,3 +675,96 @@ void HitKDNode::HitTestXRay(const Ball * const pball, vector<HitObject*> &pvhoHi
          }
    }
 }
+
+void HitBallGrid::Update()
+{
+   const vector<HitObject*> &vho = *m_org_vho;
+   const size_t n = vho.size();
+
+   float cellSize = 0.f;
+   for (HitObject * const pho : vho)
+   {
+      pho->CalcHitBBox(); // need to update here, as only done lazily for balls
+      cellSize = max(cellSize, max(pho->m_hitBBox.right - pho->m_hitBBox.left, pho->m_hitBBox.bottom - pho->m_hitBBox.top));
+   }
+   m_invCellSize = (cellSize > 0.f) ? 1.0f / cellSize : 0.f;
+
+   unsigned int nBuckets = 16;
+   while (nBuckets < 2 * n)
+      nBuckets <<= 1;
+   m_mask = nBuckets - 1;
+   m_bucketStart.assign(nBuckets + 1, 0);
+
+   m_unsorted.resize(n);
+   for (size_t i = 0; i < n; ++i)
+   {
+      const FRect3D &bbox = vho[i]->m_hitBBox;
+      Entry &e = m_unsorted[i];
+      e.x = CellCoord((bbox.left + bbox.right) * 0.5f);
+      e.y = CellCoord((bbox.top + bbox.bottom) * 0.5f);
+      e.pho = vho[i];
+      m_bucketStart[Hash(e.x, e.y)]++;
+   }
+
+   // counting sort: turn counts into bucket end offsets, then scatter backwards (keeping the original order inside each bucket),
+   // which leaves each offset at the start of its bucket
+   for (unsigned int i = 1; i < nBuckets; ++i)
+      m_bucketStart[i] += m_bucketStart[i - 1];
+   m_bucketStart[nBuckets] = (unsigned int)n;
+   m_entries.resize(n);
+   for (size_t i = n; i-- > 0;)
+      m_entries[--m_bucketStart[Hash(m_unsorted[i].x, m_unsorted[i].y)]] = m_unsorted[i];
+}
+
+void HitBallGrid::HitTestBall(const Ball * const pball, CollisionEvent& coll) const
+{
+   if (m_entries.empty())
+      return;
+
+   const float rcHitRadiusSqr = pball->HitRadiusSqr();
+   const int cx = CellCoord((pball->m_hitBBox.left + pball->m_hitBBox.right) * 0.5f);
+   const int cy = CellCoord((pball->m_hitBBox.top + pball->m_hitBBox.bottom) * 0.5f);
+
+   for (int y = cy - 1; y <= cy + 1; ++y)
+      for (int x = cx - 1; x <= cx + 1; ++x)
+      {
+         const unsigned int h = Hash(x, y);
+         for (unsigned int i = m_bucketStart[h]; i < m_bucketStart[h + 1]; ++i)
+         {
+            const Entry &e = m_entries[i];
+            if (e.x != x || e.y != y) // other cell sharing the same bucket
+               continue;
+#ifdef DEBUGPHYSICS
+            g_pplayer->c_tested++;
+#endif
+            if ((pball != e.pho) // ball can not hit itself
+               && fRectIntersect3D(pball->m_d.m_pos, rcHitRadiusSqr, e.pho->m_hitBBox))
+            {
+               DoHitTest(pball, e.pho, coll);
+            }
+         }
+      }
+}
+
+// The x-ray ball spans the whole view frustum and is not limited by the cell size, so simply test all balls
+void HitBallGrid::HitTestXRay(const Ball * const pball, vector<HitObject*> &pvhoHit, CollisionEvent& coll) const
+{
+   const float rcHitRadiusSqr = pball->HitRadiusSqr();
+
+   for (const Entry &e : m_entries)
+   {
+#ifdef DEBUGPHYSICS
+      g_pplayer->c_tested++;
+#endif
+      if ((pball != e.pho) && // ball cannot hit itself
+         fRectIntersect3D(pball->m_d.m_pos, rcHitRadiusSqr, e.pho->m_hitBBox))
+      {
+#ifdef DEBUGPHYSICS
+         g_pplayer->c_deepTested++;
+#endif
+         const float newtime = e.pho->HitTest(pball->m_d, coll.m_hittime, coll);
+         if (newtime >= 0)
+            pvhoHit.push_back(e.pho);
+      }
+   }
+}
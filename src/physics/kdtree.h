@@ -102,3 +102,41 @@ private:
 
    friend class HitKDNode;
 };
+
+// Uniform grid broad-phase dedicated to balls, to be used instead of HitKD for ball vs ball collisions (see "BallSpatialHash" setting).
+// Each ball is stored in the cell containing the center of its hit bounding box. Cells are at least as large as the biggest
+// ball hit bounding box, so all balls that may be hit by a ball are found in the 3x3 cells around it. Cells are hashed to
+// buckets that are counting-sorted on each update, so the structure is rebuilt in linear time without any tree traversal.
+class HitBallGrid final
+{
+public:
+   void FillFromVector(vector<HitObject*> &vho)
+   {
+      m_org_vho = &vho;
+      Update();
+   }
+
+   // call when the bounding boxes of the HitObjects have changed to update the grid
+   void Update();
+
+   void HitTestBall(const Ball * const pball, CollisionEvent& coll) const;
+   void HitTestXRay(const Ball * const pball, vector<HitObject*> &pvhoHit, CollisionEvent& coll) const;
+
+private:
+   struct Entry
+   {
+      int x, y;
+      HitObject *pho;
+   };
+
+   int CellCoord(const float v) const { return (int)floorf(v * m_invCellSize); }
+   unsigned int Hash(const int x, const int y) const { return ((unsigned int)x * 73856093u ^ (unsigned int)y * 19349663u) & m_mask; }
+
+   vector<HitObject*> *m_org_vho = nullptr;
+
+   float m_invCellSize = 0.f;
+   unsigned int m_mask = 0;
+   vector<unsigned int> m_bucketStart; // entries of bucket i are m_entries[m_bucketStart[i]..m_bucketStart[i+1]-1]
+   vector<Entry> m_entries;
+   vector<Entry> m_unsorted;
+};
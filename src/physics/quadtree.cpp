@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "quadtree.h"
+#include "ThreadPool.h"
 
 #ifdef ENABLE_SSE_OPTIMIZATIONS
 #define QUADTREE_SSE_LEAFTEST
@@ -87,7 +88,7 @@ void HitQuadtree::Initialize()
    g_pplayer->c_quadObjects = (U32)m_vho.size();
 #endif
 
-   CreateNextLevel(bounds, 0, 0);
+   CreateTree(bounds);
 #endif
 }
 
@@ -107,7 +108,7 @@ void HitQuadtree::Initialize(const FRect& bounds)
    g_pplayer->c_quadObjects = (U32)m_vho.size();
 #endif
 
-   CreateNextLevel(bounds, 0, 0);
+   CreateTree(bounds);
 #endif
 }
 
@@ -128,9 +129,35 @@ void HitQuadtree::Update()
 
 #else
 
+// Subtrees holding at most this amount of hit objects are built as a single task
+#define QUADTREE_TASK_MAX_ITEMS 4096
+
+// Large trees are built in two passes: the top levels are subdivided on the calling thread until the nodes hold few enough
+// hit objects, then these subtrees are built in parallel. As each subtree only depends on its own hit objects and bounds,
+// the resulting tree is exactly the same as the one of a sequential build.
+void HitQuadtree::CreateTree(const FRect& bounds)
+{
+   if (m_vho.size() <= QUADTREE_TASK_MAX_ITEMS)
+   {
+      CreateNextLevel(bounds, 0, 0);
+      return;
+   }
+
+   vector<SubtreeTask> deferred;
+   CreateNextLevel(bounds, 0, 0, &deferred);
+
+   ThreadPool pool(g_pvp->m_logicalNumberOfProcessors);
+   for (const SubtreeTask &task : deferred)
+      pool.enqueue([task] {
+         task.node->CreateNextLevel(task.bounds, task.level, task.level_empty);
+         task.node->InitSseArrays(); // in case the subtree root did not get subdivided (otherwise already done)
+      });
+   pool.wait_until_nothing_in_flight();
+}
+
 // Ported at: VisualPinball.Engine/Physics/HitQuadTree.cs
 
-void HitQuadtree::CreateNextLevel(const FRect& bounds, const unsigned int level, unsigned int level_empty)
+void HitQuadtree::CreateNextLevel(const FRect& bounds, const unsigned int level, unsigned int level_empty, vector<SubtreeTask> *deferred)
 {
    if (m_vho.size() <= 4) //!! magic
       return;
@@ -195,6 +222,7 @@ void HitQuadtree::CreateNextLevel(const FRect& bounds, const unsigned int level,
    else
       level_empty = 0;
 
+   bool childDeferred[4] = { false, false, false, false };
    if (m_vcenter.x - bounds.left > 0.0001f && //!! magic
       level_empty <= 8 && // If 8 levels were all just subdividing the same objects without luck, exit & Free the nodes again (but at least empty space was cut off)
       level + 1 < 128 / 3)
@@ -210,12 +238,20 @@ void HitQuadtree::CreateNextLevel(const FRect& bounds, const unsigned int level,
          childBounds.bottom = (i & 2) ? bounds.bottom : m_vcenter.y;
          //childBounds.zhigh = bounds.zhigh;
 
-         m_children[i].CreateNextLevel(childBounds, level + 1, level_empty);
+         const size_t childItems = m_children[i].m_vho.size();
+         if (deferred && childItems > 4 && childItems <= QUADTREE_TASK_MAX_ITEMS)
+         {
+            deferred->push_back({ &m_children[i], childBounds, level + 1, level_empty });
+            childDeferred[i] = true;
+         }
+         else
+            m_children[i].CreateNextLevel(childBounds, level + 1, level_empty, deferred);
       }
 
    InitSseArrays();
    for (int i = 0; i < 4; ++i)
-      m_children[i].InitSseArrays();
+      if (!childDeferred[i]) // deferred subtrees do it once built, as their hit object list changes when being subdivided
+         m_children[i].InitSseArrays();
 }
 
 //
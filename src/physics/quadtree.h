@@ -46,7 +46,17 @@ private:
    void Initialize();
 
 #ifndef USE_EMBREE
-   void CreateNextLevel(const FRect& bounds, const unsigned int level, unsigned int level_empty); // FRect3D for an octree
+   // subtree whose construction is deferred to a worker thread, see CreateTree
+   struct SubtreeTask
+   {
+      HitQuadtree *node;
+      FRect bounds;
+      unsigned int level;
+      unsigned int level_empty;
+   };
+
+   void CreateTree(const FRect& bounds);
+   void CreateNextLevel(const FRect& bounds, const unsigned int level, unsigned int level_empty, vector<SubtreeTask> *deferred = nullptr); // FRect3D for an octree
    void HitTestBallSse(const Ball * const pball, CollisionEvent& coll) const;
 
    IFireEvents* __restrict m_unique; // everything below/including this node shares the same original primitive/hittarget object (just for early outs if not collidable),
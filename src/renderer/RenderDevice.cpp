@@ -1484,6 +1484,8 @@ void RenderDevice::Flip()
    m_curDrawnTriangles = 0;
    m_frameTextureUpdates = m_curTextureUpdates;
    m_curTextureUpdates = 0;
+   m_frameTextureUploadBytes = m_curTextureUploadBytes;
+   m_curTextureUploadBytes = 0;
    m_frameLockCalls = m_curLockCalls;
    m_curLockCalls = 0;
 }
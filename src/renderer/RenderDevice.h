@@ -250,6 +250,7 @@ public:
    unsigned int Perf_GetNumParameterChanges() const { return m_frameParameterChanges; }
    unsigned int Perf_GetNumTechniqueChanges() const { return m_frameTechniqueChanges; }
    unsigned int Perf_GetNumTextureUploads() const   { return m_frameTextureUpdates; }
+   unsigned int Perf_GetTextureUploadBytes() const  { return m_frameTextureUploadBytes; }
    unsigned int Perf_GetNumLockCalls() const        { return m_frameLockCalls; }
 
    void FreeShader();
@@ -359,6 +360,7 @@ public:
    unsigned int m_curParameterChanges = 0, m_frameParameterChanges = 0;
    unsigned int m_curTechniqueChanges = 0, m_frameTechniqueChanges = 0;
    unsigned int m_curTextureUpdates = 0, m_frameTextureUpdates = 0;
+   unsigned int m_curTextureUploadBytes = 0, m_frameTextureUploadBytes = 0;
    unsigned int m_curLockCalls = 0, m_frameLockCalls = 0;
    unsigned int m_curDrawnTriangles = 0, m_frameDrawnTriangles = 0;
 
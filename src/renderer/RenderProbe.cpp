@@ -370,7 +370,7 @@ void RenderProbe::PreRenderStaticReflectionProbe()
       m_rd->SetRenderTarget(""s, nullptr);
 
    // if rendering static/with heavy oversampling, re-enable the aniso/trilinear filter now for the normal rendering
-   const bool forceAniso = g_pplayer->m_ptable->m_settings.LoadValueWithDefault(Settings::Player, "ForceAnisotropicFiltering"s, true);
+   const bool forceAniso = g_pplayer->m_ptable->m_settings.LoadBool(Settings::Player_ForceAnisotropicFiltering);
    m_rd->SetMainTextureDefaultFiltering(forceAniso ? SF_ANISOTROPIC : SF_TRILINEAR);
 }
 
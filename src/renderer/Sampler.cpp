@@ -14,6 +14,7 @@ Sampler::Sampler(RenderDevice* rd, BaseTexture* const surf, const bool force_lin
    m_filter(filter)
 {
    m_rd->m_curTextureUpdates++;
+   m_rd->m_curTextureUploadBytes += surf->pitch() * surf->height();
 #ifdef ENABLE_SDL
    m_texTarget = GL_TEXTURE_2D;
    colorFormat format;
@@ -136,6 +137,13 @@ void Sampler::Unbind()
 }
 
 void Sampler::UpdateTexture(BaseTexture* const surf, const bool force_linear_rgb)
+{
+   const RECT rect = { 0, 0, (LONG)surf->width(), (LONG)surf->height() };
+   UpdateTexture(surf, force_linear_rgb, rect);
+   GenerateMipmaps();
+}
+
+void Sampler::UpdateTexture(BaseTexture* const surf, const bool force_linear_rgb, const RECT& rect)
 {
 #ifdef ENABLE_SDL
    colorFormat format;
@@ -176,20 +184,44 @@ void Sampler::UpdateTexture(BaseTexture* const surf, const bool force_linear_rgb
    tex_unit->sampler = nullptr;
    glActiveTexture(GL_TEXTURE0 + tex_unit->unit);
 
+   // Compressed textures can only be updated by blocks of 4x4 texels
+   const LONG left = rect.left & ~3l, top = rect.top & ~3l;
+   const LONG right = min((rect.right + 3l) & ~3l, (LONG)surf->width()), bottom = min((rect.bottom + 3l) & ~3l, (LONG)surf->height());
+   const unsigned int bpp = surf->pitch() / surf->width();
    glBindTexture(m_texTarget, m_texture);
    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-   glTexSubImage2D(m_texTarget, 0, 0, 0, surf->width(), surf->height(), col_format, col_type, surf->data());
-   glGenerateMipmap(m_texTarget); // Generate mip-maps
+   glPixelStorei(GL_UNPACK_ROW_LENGTH, surf->width());
+   glTexSubImage2D(m_texTarget, 0, left, top, right - left, bottom - top, col_format, col_type, surf->data() + ((size_t)top * surf->width() + left) * bpp);
+   glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
    glBindTexture(m_texTarget, 0);
+   m_rd->m_curTextureUploadBytes += (right - left) * (bottom - top) * bpp;
 #else
+   // DX9 textures are uploaded through a system memory copy of the whole texture, so partial updates are not supported
    colorFormat texformat;
    IDirect3DTexture9* sysTex = CreateSystemTexture(surf, force_linear_rgb, texformat);
    CHECKD3D(m_rd->GetCoreDevice()->UpdateTexture(sysTex, m_texture));
    SAFE_RELEASE(sysTex);
+   m_rd->m_curTextureUploadBytes += surf->pitch() * surf->height();
 #endif
    m_rd->m_curTextureUpdates++;
 }
 
+void Sampler::GenerateMipmaps()
+{
+#ifdef ENABLE_SDL
+   // Update bind cache
+   auto tex_unit = m_rd->m_samplerBindings.back();
+   if (tex_unit->sampler != nullptr)
+      tex_unit->sampler->m_bindings.erase(tex_unit);
+   tex_unit->sampler = nullptr;
+   glActiveTexture(GL_TEXTURE0 + tex_unit->unit);
+
+   glBindTexture(m_texTarget, m_texture);
+   glGenerateMipmap(m_texTarget);
+   glBindTexture(m_texTarget, 0);
+#endif
+}
+
 void Sampler::SetClamp(const SamplerAddressMode clampu, const SamplerAddressMode clampv)
 {
    m_clampu = clampu;
@@ -303,7 +335,22 @@ GLuint Sampler::CreateTexture(BaseTexture* const surf, unsigned int Levels, colo
       // This line causes a false GLIntercept error log on OpenGL >= 403 since the image is initialized through TexStorage and not TexImage (expected by GLIntercept)
       // InterceptImage::SetImageDirtyPost - Flagging an image as dirty when it is not ready/init?
       glTexSubImage2D(m_texTarget, 0, 0, 0, Width, Height, col_format, col_type, data);
-      glGenerateMipmap(m_texTarget); // Generate mip-maps, when using TexStorage will generate same amount as specified in TexStorage, otherwise good idea to limit by GL_TEXTURE_MAX_LEVEL
+      // Use the mipmaps precomputed on the CPU if any (they are sRGB correct and avoid the GPU generation stall), unless the texture is compressed by the driver
+      // or the color space does not match (they are filtered in the color space of the source image)
+      const vector<BaseTexture*>& mipmaps = surf->GetMipmaps();
+      const bool surf_is_srgb = surf->m_format == BaseTexture::SRGB || surf->m_format == BaseTexture::SRGBA;
+      if (comp_format == Format && mipmaps.size() == (size_t)(num_mips - 1) && surf_is_srgb == !col_is_linear)
+      {
+         for (int i = 1; i < num_mips; i++)
+         {
+            BaseTexture* const mip = mipmaps[i - 1];
+            glTexSubImage2D(m_texTarget, i, 0, 0, mip->width(), mip->height(), col_format, col_type, mip->data());
+         }
+      }
+      else
+         glGenerateMipmap(m_texTarget); // Generate mip-maps, when using TexStorage will generate same amount as specified in TexStorage, otherwise good idea to limit by GL_TEXTURE_MAX_LEVEL
+      // Mipmaps are only needed for the upload
+      surf->ReleaseMipmaps();
    }
    return texture;
 }
@@ -57,6 +57,8 @@ public:
 
    void Unbind();
    void UpdateTexture(BaseTexture* const surf, const bool force_linear_rgb);
+   void UpdateTexture(BaseTexture* const surf, const bool force_linear_rgb, const RECT& rect); // Only upload the given region (the whole texture is uploaded on DX9), mipmaps must then be regenerated with GenerateMipmaps
+   void GenerateMipmaps(); // Regenerate the mipmaps from the base level (DX9 textures are updated with their mipmaps)
    void SetClamp(const SamplerAddressMode clampu, const SamplerAddressMode clampv);
    void SetFilter(const SamplerFilter filter);
    void SetName(const string& name);
@@ -23,9 +23,83 @@ BaseTexture::BaseTexture(const unsigned int w, const unsigned int h, const Forma
 
 BaseTexture::~BaseTexture()
 {
+   ReleaseMipmaps();
    delete[] m_data;
 }
 
+void BaseTexture::ReleaseMipmaps()
+{
+   for (BaseTexture* const mip : m_mipmaps)
+      delete mip;
+   m_mipmaps.clear();
+}
+
+void BaseTexture::GenerateMipmaps()
+{
+   if (!m_mipmaps.empty() || (m_format != BW && m_format != RGB && m_format != RGBA && m_format != SRGB && m_format != SRGBA))
+      return;
+
+   // sRGB <-> linear conversion tables, the linear to sRGB one being indexed by 12 bit linear values (thread safe static initialization)
+   static const struct ConversionTables
+   {
+      ConversionTables()
+      {
+         for (int i = 0; i < 256; i++)
+         {
+            const float x = (float)i * (float)(1.0 / 255.0);
+            sRGBToLinear[i] = (x <= 0.04045f) ? (x * (float)(1.0 / 12.92)) : powf(x * (float)(1.0 / 1.055) + (float)(0.055 / 1.055), 2.4f);
+         }
+         for (int i = 0; i < 4096; i++)
+         {
+            const float x = (float)i * (float)(1.0 / 4095.0);
+            const float s = (x <= 0.0031308f) ? (12.92f * x) : (1.055f * powf(x, (float)(1.0 / 2.4)) - 0.055f);
+            linearTosRGB[i] = (BYTE)clamp(s * 255.f + 0.5f, 0.f, 255.f);
+         }
+      }
+      float sRGBToLinear[256];
+      BYTE linearTosRGB[4096];
+   } tables;
+   const float* const sRGBToLinear = tables.sRGBToLinear;
+   const BYTE* const linearTosRGB = tables.linearTosRGB;
+
+   const bool isSRGB = m_format == SRGB || m_format == SRGBA;
+   const unsigned int nChannels = m_format == BW ? 1 : has_alpha() ? 4 : 3;
+   const unsigned int nColorChannels = m_format == BW ? 1 : 3;
+   const BaseTexture* src = this;
+   while (src->width() > 1 || src->height() > 1)
+   {
+      const unsigned int sw = src->width(), sh = src->height();
+      const unsigned int dw = max(sw / 2, 1u), dh = max(sh / 2, 1u);
+      BaseTexture* const dst = new BaseTexture(dw, dh, m_format);
+      const unsigned int spitch = src->pitch(), dpitch = dst->pitch();
+      const BYTE* const __restrict psrc = src->m_data;
+      BYTE* const __restrict pdst = dst->m_data;
+      // 2x2 box filter (clamped on the last row/column of odd sized levels)
+      for (unsigned int y = 0; y < dh; y++)
+      {
+         const BYTE* const row0 = psrc + min(y * 2, sh - 1) * spitch;
+         const BYTE* const row1 = psrc + min(y * 2 + 1, sh - 1) * spitch;
+         BYTE* const drow = pdst + y * dpitch;
+         for (unsigned int x = 0; x < dw; x++)
+         {
+            const unsigned int o0 = min(x * 2, sw - 1) * nChannels, o1 = min(x * 2 + 1, sw - 1) * nChannels;
+            for (unsigned int c = 0; c < nChannels; c++)
+            {
+               if (isSRGB && c < nColorChannels)
+               {
+                  const float v = (sRGBToLinear[row0[o0 + c]] + sRGBToLinear[row0[o1 + c]] + sRGBToLinear[row1[o0 + c]] + sRGBToLinear[row1[o1 + c]]) * (float)(4095.0 / 4.0);
+                  drow[x * nChannels + c] = linearTosRGB[(unsigned int)(v + 0.5f)];
+               }
+               else
+                  drow[x * nChannels + c] = (BYTE)((row0[o0 + c] + row0[o1 + c] + row1[o0 + c] + row1[o1 + c] + 2) >> 2);
+            }
+         }
+      }
+      m_mipmaps.push_back(dst);
+      src = dst;
+   }
+}
+
 
 BaseTexture* BaseTexture::CreateFromFreeImage(FIBITMAP* dib, bool resize_on_low_mem, unsigned int maxTexDim)
 {
@@ -631,10 +705,16 @@ HRESULT Texture::SaveToStream(IStream *pstream, const PinTable *pt)
    // Write after the texture data to ease the loading since these fields are part of texture data object
    if (m_pdsBuffer && m_pdsBuffer->IsMD5HashComputed())
       bw.WriteStruct(FID(MD5H), m_pdsBuffer->GetMD5Hash(), 16);
+   else if (m_decodePending && m_pendingMD5Set)
+      bw.WriteStruct(FID(MD5H), m_pendingMD5, 16);
    if (m_pdsBuffer && m_pdsBuffer->IsOpaqueComputed())
       bw.WriteBool(FID(OPAQ), m_pdsBuffer->IsOpaque());
+   else if (m_decodePending && m_pendingOpaque != -1)
+      bw.WriteBool(FID(OPAQ), m_pendingOpaque == 1);
    if (m_pdsBuffer)
       bw.WriteBool(FID(SIGN), m_pdsBuffer->IsSigned());
+   else if (m_decodePending)
+      bw.WriteBool(FID(SIGN), m_pendingSigned);
    bw.WriteTag(FID(ENDB));
    return S_OK;
 }
@@ -646,7 +726,33 @@ HRESULT Texture::LoadFromStream(IStream* pstream, int version, PinTable* pt, boo
    m_resize_on_low_mem = resize_on_low_mem;
    br.Load();
    m_resize_on_low_mem = tmp;
-   return ((m_pdsBuffer != nullptr) ? S_OK : E_FAIL);
+   return IsLoaded() ? S_OK : E_FAIL;
+}
+
+BaseTexture *Texture::GetRawBitmap()
+{
+   if (m_decodePending)
+   {
+      m_decodePending = false;
+      const bool resize_on_low_mem = m_resize_on_low_mem;
+      m_resize_on_low_mem = m_pendingResizeOnLowMem;
+      const bool decoded = LoadFromMemory((BYTE *)m_ppb->m_pdata, m_ppb->m_cdata);
+      m_resize_on_low_mem = resize_on_low_mem;
+      if (!decoded)
+      {
+         // Only the image header was checked at load time, so use a black placeholder instead of failing
+         PLOGE << "Image '" << m_szName << "' could not be decoded";
+         m_pdsBuffer = new BaseTexture(MIN_TEXTURE_SIZE, MIN_TEXTURE_SIZE, BaseTexture::SRGB);
+         memset(m_pdsBuffer->data(), 0, (size_t)m_pdsBuffer->height() * m_pdsBuffer->pitch());
+         SetSizeFrom(m_pdsBuffer);
+      }
+      if (m_pendingMD5Set)
+         m_pdsBuffer->SetMD5Hash(m_pendingMD5);
+      if (m_pendingOpaque != -1)
+         m_pdsBuffer->SetIsOpaque(m_pendingOpaque == 1);
+      m_pdsBuffer->SetIsSigned(m_pendingSigned);
+   }
+   return m_pdsBuffer;
 }
 
 bool Texture::LoadFromFile(const string& filename, const bool setName)
@@ -784,9 +890,9 @@ bool Texture::LoadToken(const int id, BiffReader * const pbr)
    case FID(WDTH): pbr->GetInt(m_width); break;
    case FID(HGHT): pbr->GetInt(m_height); break;
    case FID(ALTV): pbr->GetFloat(m_alphaTestValue); m_alphaTestValue *= (float)(1.0 / 255.0); break;
-   case FID(MD5H): if (m_pdsBuffer) { uint8_t md5[16]; pbr->GetStruct(md5, 16); m_pdsBuffer->SetMD5Hash(md5); } break;
-   case FID(OPAQ): if (m_pdsBuffer) { bool v; pbr->GetBool(v); m_pdsBuffer->SetIsOpaque(v); } break;
-   case FID(SIGN): if (m_pdsBuffer) { bool v; pbr->GetBool(v); m_pdsBuffer->SetIsSigned(v); } break;
+   case FID(MD5H): if (m_pdsBuffer) { uint8_t md5[16]; pbr->GetStruct(md5, 16); m_pdsBuffer->SetMD5Hash(md5); } else if (m_decodePending) { pbr->GetStruct(m_pendingMD5, 16); m_pendingMD5Set = true; } break;
+   case FID(OPAQ): if (m_pdsBuffer) { bool v; pbr->GetBool(v); m_pdsBuffer->SetIsOpaque(v); } else if (m_decodePending) { bool v; pbr->GetBool(v); m_pendingOpaque = v ? 1 : 0; } break;
+   case FID(SIGN): if (m_pdsBuffer) { bool v; pbr->GetBool(v); m_pdsBuffer->SetIsSigned(v); } else if (m_decodePending) { pbr->GetBool(m_pendingSigned); } break;
    case FID(BITS):
    {
       if (m_pdsBuffer)
@@ -859,6 +965,8 @@ bool Texture::LoadToken(const int id, BiffReader * const pbr)
       // m_ppb->m_szPath has the original filename
       // m_ppb->m_pdata() is the buffer
       // m_ppb->m_cdata() is the filesize
+      if (m_lazyDecode)
+         return DeferDecoding();
       return LoadFromMemory((BYTE*)m_ppb->m_pdata, m_ppb->m_cdata);
       //break;
    }
@@ -873,6 +981,8 @@ bool Texture::LoadToken(const int id, BiffReader * const pbr)
          assert(!"Invalid PinBinary");
          return false;
       }
+      if (m_lazyDecode)
+         return DeferDecoding();
       return LoadFromMemory((BYTE*)m_ppb->m_pdata, m_ppb->m_cdata);
       //break;
    }
@@ -880,10 +990,49 @@ bool Texture::LoadToken(const int id, BiffReader * const pbr)
    return true;
 }
 
+// Keep the compressed image (m_ppb), it will be decoded on first use. Only the image header is checked, to reject undecodable images
+// at load time like when decoding them immediately, and to know if it is a HDR image. The image size was read from WDTH/HGHT, stored
+// before the image data.
+bool Texture::DeferDecoding()
+{
+   FIMEMORY * const hmem = FreeImage_OpenMemory((BYTE *)m_ppb->m_pdata, m_ppb->m_cdata);
+   if (!hmem)
+      return false;
+   const FREE_IMAGE_FORMAT fif = FreeImage_GetFileTypeFromMemory(hmem, 0);
+   bool valid = fif != FIF_UNKNOWN && FreeImage_FIFSupportsReading(fif);
+   bool isHDR = false;
+   if (valid && FreeImage_FIFSupportsNoPixels(fif))
+   {
+      FIBITMAP * const dib = FreeImage_LoadFromMemory(fif, hmem, FIF_LOAD_NOPIXELS);
+      valid = dib != nullptr;
+      if (dib)
+      {
+         const FREE_IMAGE_TYPE img_type = FreeImage_GetImageType(dib);
+         isHDR = (img_type == FIT_FLOAT) || (img_type == FIT_DOUBLE) || (img_type == FIT_RGBF) || (img_type == FIT_RGBAF); // same as BaseTexture::CreateFromFreeImage
+         FreeImage_Unload(dib);
+      }
+   }
+   else
+      isHDR = (fif == FIF_HDR) || (fif == FIF_EXR) || (fif == FIF_PFM);
+   FreeImage_CloseMemory(hmem);
+   if (!valid)
+      return false;
+
+   m_realWidth = m_width;
+   m_realHeight = m_height;
+   m_decodePending = true;
+   m_pendingHDR = isHDR;
+   m_pendingResizeOnLowMem = m_resize_on_low_mem;
+   return true;
+}
+
 void Texture::FreeStuff()
 {
    delete m_pdsBuffer;
    m_pdsBuffer = nullptr;
+   m_decodePending = false;
+   m_pendingMD5Set = false;
+   m_pendingOpaque = -1;
    if (m_hbmGDIVersion)
    {
       if(m_hbmGDIVersion != g_pvp->m_hbmInPlayMode)
@@ -922,7 +1071,7 @@ void Texture::CreateGDIVersion()
    bmi.bmiHeader.biCompression = BI_RGB;
    bmi.bmiHeader.biSizeImage = 0;
 
-   BaseTexture* bgr32bits = m_pdsBuffer->ToBGRA();
+   BaseTexture* bgr32bits = GetRawBitmap()->ToBGRA();
    SetStretchBltMode(hdcNew, COLORONCOLOR);
    StretchDIBits(hdcNew,
       0, 0, m_width, m_height,
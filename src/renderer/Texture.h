@@ -45,6 +45,11 @@ public:
    bool IsOpaque() const { UpdateOpaque(); return m_isOpaque; }
    bool IsSigned() const { return m_isSigned; }
 
+   // Precomputed mipmap chain (from level 1 down to 1x1), only supported for 8 bit per channel formats (filtered in linear space for sRGB formats)
+   void GenerateMipmaps();
+   void ReleaseMipmaps();
+   const vector<BaseTexture*>& GetMipmaps() const { return m_mipmaps; }
+
    bool IsMD5HashComputed() const { return !m_isMD5Dirty; }
    bool IsOpaqueComputed() const { return !m_isOpaqueDirty; }
    void SetMD5Hash(uint8_t* md5) { memcpy(m_md5Hash, md5, sizeof(m_md5Hash)); m_isMD5Dirty = false; }
@@ -58,6 +63,8 @@ private:
    const unsigned int m_width, m_height;
    BYTE* m_data;
 
+   vector<BaseTexture*> m_mipmaps;
+
    // These field are (lazily) computed from the data, therefore they do not impact the constness of the object
    mutable bool m_isSigned = false;
    mutable bool m_isMD5Dirty = true;
@@ -89,9 +96,17 @@ public:
 
    bool IsHDR() const
    {
-      return m_pdsBuffer != nullptr && (m_pdsBuffer->m_format == BaseTexture::RGB_FP16 || m_pdsBuffer->m_format == BaseTexture::RGB_FP32);
+      if (m_pdsBuffer == nullptr)
+         return m_decodePending && m_pendingHDR; // not decoded yet: use the image type found when checking the image at load time
+      return m_pdsBuffer->m_format == BaseTexture::RGB_FP16 || m_pdsBuffer->m_format == BaseTexture::RGB_FP32;
    }
 
+   // Decoded image. Images loaded from a table with lazy decoding enabled are kept in their compressed form (m_ppb) until first needed
+   BaseTexture *GetRawBitmap();
+   BaseTexture *GetRawBitmapIfDecoded() const { return m_pdsBuffer; }
+   bool IsLoaded() const { return m_pdsBuffer != nullptr || m_decodePending; }
+   size_t GetRawBitmapSize() const { return m_pdsBuffer ? (size_t)m_pdsBuffer->height() * m_pdsBuffer->pitch() : (size_t)m_width * m_height * 4; } // estimated when not decoded yet
+
    void SetSizeFrom(const BaseTexture* const tex)
    {
       m_width = tex->width();
@@ -109,13 +124,13 @@ private:
 
 public:
    unsigned int m_maxTexDim = 0;
+   bool m_lazyDecode = false; // if set before loading from a stream, binary images are only decoded on first use
    
    // width and height of texture can be different than width and height
    // of m_pdsBuffer, since the surface can be limited to smaller sizes by the user
    unsigned int m_width = 0, m_height = 0;
    unsigned int m_realWidth = 0, m_realHeight = 0;
    float m_alphaTestValue = (float)(-1.0 / 255.0);
-   BaseTexture *m_pdsBuffer = nullptr;
 
    HBITMAP m_hbmGDIVersion = nullptr; // HBitmap at screen depth and converted/visualized alpha so GDI draws it fast
    PinBinary *m_ppb = nullptr; // if this image should be saved as a binary stream, otherwise just LZW compressed from the live bitmap
@@ -123,8 +138,23 @@ public:
    string m_szName;
    string m_szPath;
 
+   FastIStreamData m_autoSaveData; // data of the last autosave, reused until the table images get modified (see PinTable::SaveToStorage)
+
 private:
+   bool DeferDecoding();
+
    HBITMAP m_oldHBM = nullptr;        // this is to cache the result of SelectObject()
+
+   BaseTexture *m_pdsBuffer = nullptr;
+
+   // Lazy decoding state: image properties read from the table, applied to the image when it gets decoded
+   bool m_decodePending = false;
+   bool m_pendingMD5Set = false;
+   uint8_t m_pendingMD5[16];
+   int m_pendingOpaque = -1; // -1 if not computed
+   bool m_pendingSigned = false;
+   bool m_pendingHDR = false;
+   bool m_pendingResizeOnLowMem = true; // resize flag of the load that deferred the decoding
 };
 
 template<bool opaque>
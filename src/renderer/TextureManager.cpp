@@ -15,9 +15,9 @@ Sampler* TextureManager::LoadTexture(BaseTexture* memtex, const SamplerFilter fi
    {
       MapEntry entry;
       entry.sampler = new Sampler(&m_rd, memtex, force_linear_rgb, clampU, clampV, filter2);
-      if (g_pplayer->m_pin3d.m_envTexture != nullptr && g_pplayer->m_pin3d.m_envTexture->m_pdsBuffer == memtex)
+      if (g_pplayer->m_pin3d.m_envTexture != nullptr && g_pplayer->m_pin3d.m_envTexture->GetRawBitmapIfDecoded() == memtex)
          entry.sampler->SetName("Env"s);
-      else if (g_pplayer->m_pin3d.m_pinballEnvTexture.m_pdsBuffer == memtex)
+      else if (g_pplayer->m_pin3d.m_pinballEnvTexture.GetRawBitmapIfDecoded() == memtex)
          entry.sampler->SetName("Default Ball Env"s);
       else if (g_pplayer->m_texdmd == memtex)
          entry.sampler->SetName("DMD"s);
@@ -25,7 +25,7 @@ Sampler* TextureManager::LoadTexture(BaseTexture* memtex, const SamplerFilter fi
       {
          for (Texture* image : g_pplayer->m_ptable->m_vimage)
          {
-            if (image->m_pdsBuffer == memtex)
+            if (image->GetRawBitmapIfDecoded() == memtex)
             {
                entry.name = image->m_szName;
                entry.sampler->SetName(image->m_szName);
@@ -49,6 +49,14 @@ Sampler* TextureManager::LoadTexture(BaseTexture* memtex, const SamplerFilter fi
       {
          entry.sampler->UpdateTexture(memtex, force_linear_rgb);
          entry.sampler->m_dirty = false;
+         entry.dirtyRects.clear();
+      }
+      else if (!entry.dirtyRects.empty())
+      {
+         for (const RECT& rect : entry.dirtyRects)
+            entry.sampler->UpdateTexture(memtex, force_linear_rgb, rect);
+         entry.sampler->GenerateMipmaps();
+         entry.dirtyRects.clear();
       }
       entry.sampler->SetClamp(clampU, clampV);
       entry.sampler->SetFilter(filter2);
@@ -103,7 +111,53 @@ void TextureManager::SetDirty(BaseTexture* memtex)
 {
    const Iter it = m_map.find(memtex);
    if (it != m_map.end())
+   {
       it->second.sampler->m_dirty = true;
+      it->second.dirtyRects.clear();
+   }
+}
+
+void TextureManager::SetDirty(BaseTexture* memtex, const RECT& rect)
+{
+#ifndef ENABLE_SDL
+   // DX9 samplers always upload the whole texture (see Sampler::UpdateTexture), so regions are collapsed into a single full update
+   SetDirty(memtex);
+#else
+   const Iter it = m_map.find(memtex);
+   if (it == m_map.end() || it->second.sampler->m_dirty) // Not loaded yet, or already fully dirty
+      return;
+
+   RECT r = { max(rect.left, 0l), max(rect.top, 0l), min(rect.right, (LONG)memtex->width()), min(rect.bottom, (LONG)memtex->height()) };
+   if (r.left >= r.right || r.top >= r.bottom)
+      return;
+
+   // Merge with the overlapping or adjacent regions, until the region does not touch any other one
+   vector<RECT>& rects = it->second.dirtyRects;
+   for (size_t i = 0; i < rects.size();)
+   {
+      const RECT& o = rects[i];
+      if (r.left <= o.right && o.left <= r.right && r.top <= o.bottom && o.top <= r.bottom)
+      {
+         r = { min(r.left, o.left), min(r.top, o.top), max(r.right, o.right), max(r.bottom, o.bottom) };
+         rects[i] = rects.back();
+         rects.pop_back();
+         i = 0;
+      }
+      else
+         i++;
+   }
+   rects.push_back(r);
+
+   // Coalesce into a full upload when the regions get too fragmented or cover most of the texture
+   size_t area = 0;
+   for (const RECT& o : rects)
+      area += (size_t)(o.right - o.left) * (o.bottom - o.top);
+   if (rects.size() > MAX_DIRTY_RECTS || area * 4 >= (size_t)memtex->width() * memtex->height() * 3)
+   {
+      it->second.sampler->m_dirty = true;
+      rects.clear();
+   }
+#endif
 }
 
 void TextureManager::UnloadTexture(BaseTexture* memtex)
@@ -22,6 +22,7 @@ public:
 
    Sampler* LoadTexture(BaseTexture* memtex, const SamplerFilter filter, const SamplerAddressMode clampU, const SamplerAddressMode clampV, const bool force_linear_rgb);
    void SetDirty(BaseTexture* memtex);
+   void SetDirty(BaseTexture* memtex, const RECT& rect); // Only the given region needs to be uploaded again
    void UnloadTexture(BaseTexture* memtex);
    void UnloadAll();
 
@@ -41,7 +42,9 @@ private:
       SamplerAddressMode clampU, clampV;
       bool forceLinearRGB;
       bool preRenderOnly;
+      vector<RECT> dirtyRects; // Regions to upload if the sampler is not fully dirty (merged, not overlapping)
    };
+   static constexpr size_t MAX_DIRTY_RECTS = 16;
    RenderDevice& m_rd;
    robin_hood::unordered_map<BaseTexture*, MapEntry> m_map;
    typedef robin_hood::unordered_map<BaseTexture*, MapEntry>::iterator Iter;
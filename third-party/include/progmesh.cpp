@@ -66,8 +66,9 @@ public:
 };
 
 
-static vector<Vertex *>   vertices;
-static vector<Triangle *> triangles;
+// thread local, so that several meshes can be reduced in parallel
+static thread_local vector<Vertex *>   vertices;
+static thread_local vector<Triangle *> triangles;
 
 
 __forceinline Triangle::Triangle(Vertex * const v0, Vertex * const v1, Vertex * const v2)
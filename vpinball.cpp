@@ -2056,8 +2056,8 @@ int CALLBACK MyCompProcMemValues(LPARAM lSortParam1, LPARAM lSortParam2, LPARAM
    const SORTDATA * const lpsd = (SORTDATA *)lSortOption;
    const Texture * const t1 = (Texture *)lSortParam1;
    const Texture * const t2 = (Texture *)lSortParam2;
-   const unsigned int t1_size = t1->m_pdsBuffer == nullptr ? 0 : t1->m_pdsBuffer->height() * t1->m_pdsBuffer->pitch();
-   const unsigned int t2_size = t2->m_pdsBuffer == nullptr ? 0 : t2->m_pdsBuffer->height() * t2->m_pdsBuffer->pitch();
+   const unsigned int t1_size = (unsigned int)t1->GetRawBitmapSize();
+   const unsigned int t2_size = (unsigned int)t2->GetRawBitmapSize();
    if (lpsd->sortUpDown == 1)
       return (int)(t1_size - t2_size);
    else
@@ -2091,7 +2091,7 @@ INT_PTR CALLBACK SecurityOptionsProc(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPA
 
       SendMessage(GetDlgItem(hwndDlg, buttonid), BM_SETCHECK, BST_CHECKED, 0);
 
-      const bool hangdetect = g_pvp->m_settings.LoadValueWithDefault(Settings::Player, "DetectHang"s, false);
+      const bool hangdetect = g_pvp->m_settings.LoadBool(Settings::Player_DetectHang);
       SendMessage(GetDlgItem(hwndDlg, IDC_HANGDETECT), BM_SETCHECK, hangdetect ? BST_CHECKED : BST_UNCHECKED, 0);
 
       return TRUE;
@@ -7,9 +7,10 @@
 #define VP_VERSION_MINOR    8  // Max 2 Digits
 #define VP_VERSION_REV      0  // Max 1 Digit
 
-#define CURRENT_FILE_FORMAT_VERSION  1080
+#define CURRENT_FILE_FORMAT_VERSION  1081
 #define NO_ENCRYPTION_FORMAT_VERSION 1050
 #define NEW_SOUND_FORMAT_VERSION     1031 // introduced surround option
+#define QUANTIZED_MESH_FORMAT_VERSION 1081 // introduced quantized primitive vertices (M3QX), unknown to older versions which would load these primitives without vertices
 
 #define _STR(x)    #x
 #define STR(x)     _STR(x)
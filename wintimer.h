@@ -41,6 +41,7 @@ public:
       PROFILE_INPUT_POLL_PERIOD, // Time spent between 2 input processings.
       PROFILE_INPUT_TO_PRESENT,  // Time spent between the last input taen in account in a frame to the presentation of this frame
                                  // The overall game lag is the sum of this lag with the present to display lag obtained using PresentMon tool
+      PROFILE_CAPTURE_TO_PRESENT, // Time spent between the acquisition of an external (DMD/backglass) capture frame and the presentation of the first frame using it
       PROFILE_COUNT
    };
 
@@ -52,6 +53,9 @@ public:
       m_processInputTimeStamp = 0;
       m_prepareCount = 0;
       m_prepareTimeStamp = 0;
+      m_captureCount = 0;
+      m_captureTimeStamp = 0;
+      m_pendingCaptureTimeStamp = 0;
       for (int i = 0; i < N_SAMPLES; i++)
          memset(m_profileData[i], 0, sizeof(m_profileData[0]));
       for (int i = 0; i < PROFILE_COUNT; i++)
@@ -137,6 +141,8 @@ public:
                      default: name = "DispID[" + std::to_string(v.first) + ']';
                      }
                      ss << " spent in " << std::setw(3) << v.second.callCount << " calls of " << name;
+                     if (v.second.coalescedCount > 0)
+                        ss << " (" << v.second.coalescedCount << " coalesced)";
                      }
                      if (v.first == 1300)
                      {
@@ -283,11 +289,18 @@ public:
       }
    }
 
+   // Count events that were merged in an already pending event of the coalesced script event queue
+   void OnScriptEventCoalesced(DISPID id)
+   {
+      m_scriptEventData[id].coalescedCount++;
+   }
+
    unsigned int Get(ProfileSection section) const
    {
       assert(0 <= section && section < PROFILE_COUNT);
       return section == PROFILE_INPUT_POLL_PERIOD ? m_profileData[m_processInputIndex][PROFILE_INPUT_POLL_PERIOD]
            : section == PROFILE_INPUT_TO_PRESENT  ? m_profileData[m_prepareIndex][PROFILE_INPUT_TO_PRESENT]
+           : section == PROFILE_CAPTURE_TO_PRESENT ? m_profileData[m_captureIndex][PROFILE_CAPTURE_TO_PRESENT]
                                                   : m_profileData[m_profileIndex][section];
    }
    
@@ -296,6 +309,7 @@ public:
       assert(0 <= section && section < PROFILE_COUNT);
       return section == PROFILE_INPUT_POLL_PERIOD ? m_profileData[(m_processInputIndex + N_SAMPLES - 1) % N_SAMPLES][PROFILE_INPUT_POLL_PERIOD]
            : section == PROFILE_INPUT_TO_PRESENT  ? m_profileData[(m_prepareIndex + N_SAMPLES - 1) % N_SAMPLES][PROFILE_INPUT_TO_PRESENT]
+           : section == PROFILE_CAPTURE_TO_PRESENT ? m_profileData[(m_captureIndex + N_SAMPLES - 1) % N_SAMPLES][PROFILE_CAPTURE_TO_PRESENT]
                                                   : m_profileData[(m_profileIndex + N_SAMPLES - 1) % N_SAMPLES][section];
    }
    
@@ -316,6 +330,7 @@ public:
       assert(0 <= section && section < PROFILE_COUNT);
       return section == PROFILE_INPUT_POLL_PERIOD ? (m_processInputCount <= 0 ? 0. : ((double)m_profileTotalData[PROFILE_INPUT_POLL_PERIOD] / (double)m_processInputCount))
            : section == PROFILE_INPUT_TO_PRESENT  ? (m_prepareCount <= 0      ? 0. : ((double)m_profileTotalData[PROFILE_INPUT_TO_PRESENT] / (double)m_prepareCount))
+           : section == PROFILE_CAPTURE_TO_PRESENT ? (m_captureCount <= 0     ? 0. : ((double)m_profileTotalData[PROFILE_CAPTURE_TO_PRESENT] / (double)m_captureCount))
                                                   : (m_frameIndex <= 0        ? 0. : ((double)m_profileTotalData[section] / (double)m_frameIndex));
    }
    
@@ -388,13 +403,36 @@ public:
       m_processInputTimeStamp = ts;
    }
    
+   // Called when an external capture frame acquired at the given timestamp has been pushed to be rendered in the next frame
+   void OnCaptureUpdate(const unsigned long long captureTimeStamp)
+   {
+      if (m_pendingCaptureTimeStamp == 0 || captureTimeStamp < m_pendingCaptureTimeStamp)
+         m_pendingCaptureTimeStamp = captureTimeStamp;
+   }
+
    void OnPrepare()
    {
       m_prepareTimeStamp = m_processInputTimeStamp;
+      if (m_pendingCaptureTimeStamp != 0)
+      {
+         m_captureTimeStamp = m_pendingCaptureTimeStamp;
+         m_pendingCaptureTimeStamp = 0;
+      }
    }
    
    void OnPresent()
    {
+      if (m_captureTimeStamp != 0)
+      {
+         unsigned int elapsed = (unsigned int) (usec() - m_captureTimeStamp);
+         m_profileData[m_captureIndex][PROFILE_CAPTURE_TO_PRESENT] = elapsed;
+         m_profileMinData[PROFILE_CAPTURE_TO_PRESENT] = min(m_profileMinData[PROFILE_CAPTURE_TO_PRESENT], elapsed);
+         m_profileMaxData[PROFILE_CAPTURE_TO_PRESENT] = max(m_profileMaxData[PROFILE_CAPTURE_TO_PRESENT], elapsed);
+         m_profileTotalData[PROFILE_CAPTURE_TO_PRESENT] += elapsed;
+         m_captureIndex = (m_captureIndex + 1) % N_SAMPLES;
+         m_captureCount++;
+         m_captureTimeStamp = 0;
+      }
       if (m_prepareTimeStamp == 0)
          return;
       unsigned int elapsed = (unsigned int) (usec() - m_prepareTimeStamp);
@@ -424,6 +462,7 @@ private:
    {
       unsigned int callCount = 0;
       unsigned int totalLength = 0;
+      unsigned int coalescedCount = 0;
    };
    DISPID m_scriptEventDispID = 0;
    robin_hood::unordered_map<DISPID, EventTick> m_scriptEventData;
@@ -442,6 +481,12 @@ private:
    unsigned int m_prepareCount = 0;
    unsigned long long m_prepareTimeStamp;
 
+   // External capture lag
+   unsigned int m_captureIndex = 0;
+   unsigned int m_captureCount = 0;
+   unsigned long long m_captureTimeStamp = 0;
+   unsigned long long m_pendingCaptureTimeStamp = 0;
+
    // Raw data
    unsigned int m_profileData[N_SAMPLES][PROFILE_COUNT];
    unsigned int m_profileMaxData[PROFILE_COUNT];